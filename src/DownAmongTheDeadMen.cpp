@@ -29,6 +29,16 @@ namespace fs = std::filesystem;
 #include "ships.hpp"
 #include "character.hpp"
 #include "story.hpp"
+#include "engine.hpp"
+#include "hint.hpp"
+#include "autosave.hpp"
+#include "journal.hpp"
+#include "rewind.hpp"
+#include "savefile.hpp"
+#include "saveindex.hpp"
+#include "saveslot.hpp"
+#include "storycontrols.hpp"
+#include "thumbnail.hpp"
 
 #if defined(_WIN32)
 
@@ -43,19 +53,50 @@ namespace fs = std::filesystem;
 
 #endif
 
+// searches for the best line in the background while the player reads
+Hint::Advisor advisor(18);
+
+// decisions of the session in progress, see storyScreen
+Journal::Writer journal;
+
+// the character as they entered each of the last few hundred sections
+Rewind::Ring history(256);
+
+// summaries of the saved games, see summariseGame
+SaveIndex::Index saves;
+
+// writes saves out in the background, see saveGame
+SaveFile::Writer saver;
+
+// thumbnails of the saves on the load screen, see createFilesList
+SaveIndex::Thumbnails thumbnails;
+
+// the story screen as it was when the game screen was opened, saved with the game, see saveGame
+Thumbnail::Image screenshot;
+
+// slot the current character's saves go to, empty until a new character is first saved
+std::string lineage;
+
+// the character entering each section of the session in progress, see storyScreen
+Autosave::Writer autosave;
+
+// autosave the character was last loaded from, removed with the session's own when the session ends
+std::string recovered;
+
 // forward declarations
 bool aboutScreen(SDL_Window *window, SDL_Renderer *renderer);
 bool characterScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story);
-bool glossaryScreen(SDL_Window *window, SDL_Renderer *renderer, std::vector<Skill::Base> Skills);
-bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, std::vector<Item::Base> &Items, Control::Type mode, int limit);
-bool loseItems(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Type> item_types, int Limit);
+template <typename T>
+bool glossaryScreen(SDL_Window *window, SDL_Renderer *renderer, T &Skills);
+bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, Item::List &Items, Control::Type mode, int limit);
+bool loseItems(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, const std::vector<Item::Type> &item_types, int Limit);
 bool loseSkills(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, int limit);
 bool mainScreen(SDL_Window *window, SDL_Renderer *renderer, int storyID);
 bool mapScreen(SDL_Window *window, SDL_Renderer *renderer);
 bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story);
 bool shopScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, Control::Type mode);
 bool storyScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, int id);
-bool takeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Base> items, int limit, bool back_button);
+bool takeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, const Item::List &items, int limit, bool back_button);
 bool tradeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Item::Base mine, Item::Base theirs);
 
 Character::Base customCharacter(SDL_Window *window, SDL_Renderer *renderer);
@@ -238,6 +279,46 @@ void stretchImage(SDL_Renderer *renderer, SDL_Surface *image, int x, int y, int
     }
 }
 
+// the frame last drawn, read back as is: shrinking it is left to whoever keeps it
+Thumbnail::Image captureScreen(SDL_Renderer *renderer)
+{
+    auto w = 0;
+    auto h = 0;
+
+    if (!renderer || SDL_GetRendererOutputSize(renderer, &w, &h) != 0 || w <= 0 || h <= 0)
+    {
+        return Thumbnail::Image();
+    }
+
+    auto frame = Thumbnail::Image(w, h);
+
+    if (SDL_RenderReadPixels(renderer, NULL, SDL_PIXELFORMAT_RGB24, frame.Pixels.data(), w * 3) != 0)
+    {
+        return Thumbnail::Image();
+    }
+
+    return frame;
+}
+
+void renderThumbnail(SDL_Renderer *renderer, Thumbnail::Image &image, int x, int y, int w, int h)
+{
+    if (image.EMPTY())
+    {
+        return;
+    }
+
+    auto surface = SDL_CreateRGBSurfaceWithFormatFrom(image.Pixels.data(), image.Width, image.Height, 24, image.Width * 3, SDL_PIXELFORMAT_RGB24);
+
+    if (surface)
+    {
+        stretchImage(renderer, surface, x, y, w, h);
+
+        SDL_FreeSurface(surface);
+
+        surface = NULL;
+    }
+}
+
 // Render a portion of the text (image) on bounded surface within the specified window
 void renderText(SDL_Renderer *renderer, SDL_Surface *text, Uint32 bg, int x, int y, int bounds, int offset)
 {
@@ -534,7 +615,7 @@ SDL_Surface *createHeaderButton(SDL_Window *window, const char *text, SDL_Color
     return button;
 }
 
-std::vector<Button> createItemList(SDL_Window *window, SDL_Renderer *renderer, std::vector<Item::Base> list, int start, int last, int limit, bool confirm_button, bool back_button)
+std::vector<Button> createItemList(SDL_Window *window, SDL_Renderer *renderer, const Item::List &list, int start, int last, int limit, bool confirm_button, bool back_button)
 {
     auto font_size = 20;
     auto text_space = 8;
@@ -548,7 +629,7 @@ std::vector<Button> createItemList(SDL_Window *window, SDL_Renderer *renderer, s
         {
             auto index = start + i;
 
-            std::string item_string = list[index].Name;
+            std::string item_string = list[index].Name();
 
             if (list[index].Charge >= 0)
             {
@@ -653,7 +734,7 @@ bool characterScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base
                     codewords += ", ";
                 }
 
-                codewords += Codeword::Descriptions.at(player.Codewords[i]);
+                codewords += Codeword::Description(player.Codewords[i]);
             }
         }
 
@@ -725,7 +806,8 @@ bool characterScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base
     return false;
 }
 
-bool glossaryScreen(SDL_Window *window, SDL_Renderer *renderer, std::vector<Skill::Base> Skills)
+template <typename T>
+bool glossaryScreen(SDL_Window *window, SDL_Renderer *renderer, T &Skills)
 {
     std::string title = "Down Among the Dead Men: Skills Glossary";
 
@@ -833,7 +915,7 @@ bool glossaryScreen(SDL_Window *window, SDL_Renderer *renderer, std::vector<Skil
     return false;
 }
 
-bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, std::vector<Item::Base> &Items, Control::Type mode, int limit)
+bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, Item::List &Items, Control::Type mode, int limit)
 {
     if (Items.size() > 0)
     {
@@ -1032,7 +1114,9 @@ bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base
 
                         if (mode == Control::Type::DROP)
                         {
-                            Items.erase(Items.begin() + (current + offset));
+                            journal.DROP({current + offset});
+
+                            Engine::DROP(player, {current + offset});
 
                             if (offset > 0)
                             {
@@ -1048,7 +1132,7 @@ bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base
 
                             controls = createItemList(window, renderer, Items, offset, last, display_limit, false, true);
 
-                            std::string description = item.Name;
+                            std::string description = item.Name();
 
                             if (item.Charge >= 0)
                             {
@@ -1084,9 +1168,20 @@ bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base
                         {
                             if (Items.size() > limit)
                             {
-                                Items.erase(Items.begin() + (current + offset));
+                                if (&Items == &player.Items)
+                                {
+                                    journal.DROP({current + offset});
+
+                                    Engine::DROP(player, {current + offset});
+                                }
+                                else
+                                {
+                                    journal.LOSE({Items[current + offset]});
 
-                                Character::LOSE_ITEMS(player, {item.Type});
+                                    Engine::LOSE(player, Items, {current + offset});
+
+                                    Items.erase(Items.begin() + (current + offset));
+                                }
 
                                 if (offset > 0)
                                 {
@@ -1102,7 +1197,7 @@ bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base
 
                                 controls = createItemList(window, renderer, Items, offset, last, display_limit, false, true);
 
-                                std::string description = item.Name;
+                                std::string description = item.Name();
 
                                 if (item.Charge >= 0)
                                 {
@@ -1137,14 +1232,14 @@ bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base
                         }
                         else if (mode == Control::Type::USE)
                         {
-                            if (item.Type == Item::Type::HEALING_POTION)
-                            {
-                                if (player.Life < player.MAX_LIFE_LIMIT)
-                                {
-                                    player.Life = player.MAX_LIFE_LIMIT;
+                            journal.USE(current + offset);
 
-                                    Items.erase(Items.begin() + (current + offset));
+                            auto result = Engine::USE(player, current + offset);
 
+                            if (result != Engine::Result::UNUSABLE)
+                            {
+                                if (result == Engine::Result::OK)
+                                {
                                     if (offset > 0)
                                     {
                                         offset--;
@@ -1207,7 +1302,7 @@ bool inventoryScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base
     return false;
 }
 
-bool takeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Base> items, int TakeLimit, bool back_button)
+bool takeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, const Item::List &items, int TakeLimit, bool back_button)
 {
     auto done = false;
 
@@ -1318,7 +1413,7 @@ bool takeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pla
                         take += ", ";
                     }
 
-                    std::string description = items[selection[i]].Name;
+                    std::string description = items[selection[i]].Name();
 
                     if (items[selection[i]].Charge >= 0)
                     {
@@ -1458,14 +1553,7 @@ bool takeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pla
                 }
                 else if (controls[current].Type == Control::Type::CONFIRM && !hold)
                 {
-                    auto take = std::vector<Item::Base>();
-
-                    for (auto i = 0; i < selection.size(); i++)
-                    {
-                        take.push_back(items[selection[i]]);
-                    }
-
-                    Character::GET_ITEMS(player, take);
+                    journal.TAKE(Engine::TAKE(player, items, Engine::Selection(selection), TakeLimit));
 
                     current = -1;
 
@@ -1497,7 +1585,7 @@ bool takeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pla
     return done;
 }
 
-bool loseItems(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, std::vector<Item::Type> item_types, int Limit)
+bool loseItems(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, const std::vector<Item::Type> &item_types, int Limit)
 {
     auto done = false;
 
@@ -1601,7 +1689,7 @@ bool loseItems(SDL_Window *window, SDL_Renderer *renderer, Character::Base &play
                         lose += ", ";
                     }
 
-                    std::string description = player.Items[selection[i]].Name;
+                    std::string description = player.Items[selection[i]].Name();
 
                     if (player.Items[selection[i]].Charge >= 0)
                     {
@@ -1768,29 +1856,9 @@ bool loseItems(SDL_Window *window, SDL_Renderer *renderer, Character::Base &play
                 {
                     if (selection.size() == Limit)
                     {
-                        auto items = std::vector<Item::Base>();
-
-                        for (auto i = 0; i < player.Items.size(); i++)
-                        {
-                            auto found = false;
-
-                            for (auto j = 0; j < selection.size(); j++)
-                            {
-                                if (i == selection[j])
-                                {
-                                    found = true;
-
-                                    break;
-                                }
-                            }
-
-                            if (!found)
-                            {
-                                items.push_back(player.Items[i]);
-                            }
-                        }
+                        journal.BRIBE(item_types, Engine::Selection(selection));
 
-                        player.Items = items;
+                        Engine::BRIBE(player, item_types, Engine::Selection(selection));
 
                         current = -1;
 
@@ -1871,7 +1939,7 @@ void renderAdventurer(SDL_Window *window, SDL_Renderer *renderer, TTF_Font *font
             possessions += ", ";
         }
 
-        possessions += player.Items[i].Name;
+        possessions += player.Items[i].Name();
 
         if (player.Items[i].Charge >= 0)
         {
@@ -1890,11 +1958,11 @@ void renderAdventurer(SDL_Window *window, SDL_Renderer *renderer, TTF_Font *font
         }
     }
 
-    auto name_string = player.Name;
+    auto name_string = std::string(player.Name);
 
     if (player.Ship.Type != Ship::Type::NONE)
     {
-        name_string += " (" + player.Ship.Name;
+        name_string += " (" + std::string(player.Ship.Name);
 
         if (player.Ship.Stars > 0)
         {
@@ -1908,7 +1976,7 @@ void renderAdventurer(SDL_Window *window, SDL_Renderer *renderer, TTF_Font *font
     fillWindow(renderer, intWH);
 
     putText(renderer, name_string.c_str(), font, space, clrWH, intGN, TTF_STYLE_NORMAL, (player.Ship.Type != Ship::Type::NONE) ? headerw * 3 : headerw, headerh, startx, starty);
-    putText(renderer, player.Description.c_str(), font, space, clrBK, intBE, TTF_STYLE_NORMAL, profilew, profileh, startx, starty + headerh);
+    putText(renderer, player.Description, font, space, clrBK, intBE, TTF_STYLE_NORMAL, profilew, profileh, startx, starty + headerh);
 
     putText(renderer, "Skills", font, space, clrWH, intGN, TTF_STYLE_NORMAL, headerw, headerh, startx, starty + profileh + headerh + marginh);
     putText(renderer, skills.c_str(), font, space, clrBK, intBE, TTF_STYLE_NORMAL, profilew, boxh, startx, starty + profileh + 2 * headerh + marginh);
@@ -2238,6 +2306,8 @@ Character::Base customCharacter(SDL_Window *window, SDL_Renderer *renderer)
                         Character::CUSTOM.Money = 10;
                         Character::CUSTOM.Life = 10;
 
+                        Character::REHASH(Character::CUSTOM);
+
                         player = Character::CUSTOM;
 
                         current = -1;
@@ -2521,12 +2591,9 @@ std::string time_string(long deserialised)
 }
 #endif
 
-bool saveGame(Character::Base &player, const char *overwrite)
+// folder holding saved games and session journals, created if needed
+std::string saveDirectory()
 {
-    auto seed = std::chrono::system_clock::now().time_since_epoch() / std::chrono::milliseconds(1);
-
-    std::ostringstream buffer;
-
 #if defined(_WIN32)
 
     PWSTR path_str;
@@ -2543,8 +2610,6 @@ bool saveGame(Character::Base &player, const char *overwrite)
 
     save += "/Saved Games/Down Among the Dead Men";
 
-    std::string path = save + "/";
-
 #else
 
     const char *homedir;
@@ -2555,310 +2620,167 @@ bool saveGame(Character::Base &player, const char *overwrite)
     }
 
     std::string save = std::string(homedir) + "/Documents/Saved Games/Down Among the Dead Men";
-    std::string path = save + "/";
 
 #endif
 
     fs::create_directories(save);
 
-    if (overwrite != NULL)
-    {
-        buffer << std::string(overwrite);
-    }
-    else
-    {
-        buffer << path << std::to_string(seed) << ".save";
-    }
+    return save;
+}
 
-    nlohmann::json data;
+bool saveGame(Character::Base &player, const char *overwrite)
+{
+    auto seed = std::chrono::system_clock::now().time_since_epoch() / std::chrono::milliseconds(1);
 
-    player.Epoch = seed;
+    std::ostringstream buffer;
 
-    data["name"] = player.Name;
-    data["description"] = player.Description;
-    data["type"] = player.Type;
-    data["life"] = player.Life;
-    data["money"] = player.Money;
-    data["itemLimit"] = player.ITEM_LIMIT;
-    data["lifeLimit"] = player.MAX_LIFE_LIMIT;
-    data["skillsLimit"] = player.SKILLS_LIMIT;
-    data["codewords"] = player.Codewords;
-    data["epoch"] = player.Epoch;
-
-    auto skills = std::vector<Skill::Type>();
-    auto lostSkills = std::vector<Skill::Type>();
-    auto temporarySkills = std::vector<Skill::Type>();
+    std::string directory = saveDirectory();
 
-    for (auto i = 0; i < player.Skills.size(); i++)
-    {
-        skills.push_back(player.Skills[i].Type);
-    }
+    std::string path = directory + "/";
 
-    for (auto i = 0; i < player.LostSkills.size(); i++)
+    if (overwrite != NULL && !SaveSlot::IsSlot(overwrite))
     {
-        lostSkills.push_back(player.LostSkills[i].Type);
+        // saves from before slots are still written over whole
+        buffer << std::string(overwrite);
     }
-
-    for (auto i = 0; i < player.TemporarySkills.size(); i++)
+    else
     {
-        temporarySkills.push_back(player.TemporarySkills[i].Type);
-    }
-
-    data["skills"] = skills;
-    data["lostSkills"] = lostSkills;
-    data["temporarySkills"] = temporarySkills;
-    data["lostMoney"] = player.LostMoney;
-    data["storyID"] = player.StoryID;
+        if (overwrite != NULL)
+        {
+            lineage = std::string(overwrite);
+        }
+        else if (lineage.empty())
+        {
+            lineage = path + std::to_string(seed) + SaveSlot::EXTENSION;
+        }
 
-    auto items = std::vector<nlohmann::json>();
-    auto lostItems = std::vector<nlohmann::json>();
+        buffer << lineage;
+    }
 
-    for (auto i = 0; i < player.Items.size(); i++)
-    {
-        nlohmann::json item;
+    player.Epoch = seed;
 
-        item.emplace("name", player.Items[i].Name);
-        item.emplace("description", player.Items[i].Description);
-        item.emplace("type", player.Items[i].Type);
-        item.emplace("charge", player.Items[i].Charge);
+    std::string filename = buffer.str();
 
-        items.push_back(item);
-    }
+    saves.OPEN(directory);
 
-    for (auto i = 0; i < player.LostItems.size(); i++)
+    // processStory hears back once the save is safely on disk, the screen is shrunk to a thumbnail on the way
+    if (SaveSlot::IsSlot(filename))
     {
-        nlohmann::json item;
-
-        item.emplace("name", player.LostItems[i].Name);
-        item.emplace("description", player.LostItems[i].Description);
-        item.emplace("type", player.LostItems[i].Type);
-        item.emplace("charge", player.LostItems[i].Charge);
-
-        lostItems.push_back(item);
+        saver.SUBMIT(filename, player, std::move(screenshot), SaveSlot::WRITE);
     }
-
-    if (player.Ship.Type != Ship::Type::NONE)
+    else
     {
-        nlohmann::json ship;
-
-        ship.emplace("name", player.Ship.Name);
-        ship.emplace("stars", player.Ship.Stars);
-        ship.emplace("type", player.Ship.Type);
-
-        data["ship"] = ship;
+        saver.SUBMIT(filename, player, std::move(screenshot));
     }
 
-    data["lostItems"] = lostItems;
-    data["items"] = items;
-
-    std::string filename = buffer.str();
-
-    std::ofstream file(filename);
-
-    file << data.dump();
-
-    file.close();
+    screenshot = Thumbnail::Image();
 
     return true;
 }
 
 Character::Base loadGame(std::string file_name)
 {
-    std::ifstream ifs(file_name);
-
     auto character = Character::Base();
 
-    if (ifs.good())
+    if (fs::path(file_name).extension() == Autosave::EXTENSION)
     {
-        auto data = nlohmann::json::parse(ifs);
-
-        ifs.close();
-
-        std::string name = std::string(data["name"]);
-
-        std::string description = data["description"];
-
-        auto type = static_cast<Character::Type>((int)data["type"]);
-
-        auto skills = std::vector<Skill::Base>();
-        auto items = std::vector<Item::Base>();
-        auto codewords = std::vector<Codeword::Type>();
-
-        auto lostSkills = std::vector<Skill::Base>();
-        auto lostItems = std::vector<Item::Base>();
-        auto temporarySkills = std::vector<Skill::Base>();
-
-        for (auto i = 0; i < (int)data["skills"].size(); i++)
-        {
-            auto skill = static_cast<Skill::Type>((int)data["skills"][i]);
-            auto found = Skill::FIND(Skill::ALL, skill);
-
-            if (found >= 0)
-            {
-                skills.push_back(Skill::ALL[found]);
-            }
-        }
-
-        for (auto i = 0; i < (int)data["lostSkills"].size(); i++)
-        {
-            auto skill = static_cast<Skill::Type>((int)data["lostSkills"][i]);
-            auto found = Skill::FIND(Skill::ALL, skill);
-
-            if (found >= 0)
-            {
-                lostSkills.push_back(Skill::ALL[found]);
-            }
-        }
-
-        if (!data["temporarySkills"].is_null())
-        {
-            for (auto i = 0; i < (int)data["temporarySkills"].size(); i++)
-            {
-                auto skill = static_cast<Skill::Type>((int)data["temporarySkills"][i]);
-                auto found = Skill::FIND(Skill::ALL, skill);
-
-                if (found >= 0)
-                {
-                    temporarySkills.push_back(Skill::ALL[found]);
-                }
-            }
-        }
+        auto bytes = std::string();
 
-        for (auto i = 0; i < (int)data["items"].size(); i++)
-        {
-            auto item_name = std::string(data["items"][i]["name"]);
-            auto item_description = std::string(data["items"][i]["description"]);
-            auto item_type = static_cast<Item::Type>((int)data["items"][i]["type"]);
-            auto item_charge = (int)data["items"][i]["charge"];
+        auto recovery = SaveFile::READ(file_name, bytes) ? Autosave::RECOVER(bytes) : Autosave::Recovery();
 
-            items.push_back(Item::Base(item_name.c_str(), item_description.c_str(), item_type, item_charge));
-        }
+        character = recovery.Player;
 
-        for (auto i = 0; i < (int)data["lostItems"].size(); i++)
+        if (!recovery.Good)
         {
-            auto item_name = std::string(data["lostItems"][i]["name"]);
-            auto item_description = std::string(data["lostItems"][i]["description"]);
-            auto item_type = static_cast<Item::Type>((int)data["lostItems"][i]["type"]);
-            auto item_charge = (int)data["lostItems"][i]["charge"];
-
-            lostItems.push_back(Item::Base(item_name.c_str(), item_description.c_str(), item_type, item_charge));
+            character.StoryID = -1;
         }
-
-        for (auto i = 0; i < (int)data["codewords"].size(); i++)
+    }
+    else if (SaveSlot::IsSlot(file_name))
+    {
+        if (SaveSlot::LOAD(file_name, character) != SaveFile::Status::OK)
         {
-            auto codeword = static_cast<Codeword::Type>((int)data["codewords"][i]);
+            character = Character::Base();
 
-            codewords.push_back(codeword);
+            character.StoryID = -1;
         }
+    }
+    else if (SaveFile::LOAD(file_name, character) != SaveFile::Status::OK)
+    {
+        character = Character::Base();
 
-        auto money = (int)data["money"];
-        auto life = (int)data["life"];
-
-        character = Character::Base(name.c_str(), type, description.c_str(), skills, items, codewords, life, money);
+        character.StoryID = -1;
+    }
 
-        character.LostSkills = lostSkills;
-        character.LostItems = lostItems;
-        character.TemporarySkills = temporarySkills;
-        character.LostMoney = (int)data["lostMoney"];
+    return character;
+}
 
-        character.ITEM_LIMIT = (int)data["itemLimit"];
-        character.MAX_LIFE_LIMIT = (int)data["lifeLimit"];
-        character.SKILLS_LIMIT = (int)data["skillsLimit"];
-        character.StoryID = (int)data["storyID"];
+// what the load screen shows of a save, only read from the save itself when the index no longer matches the file
+SaveIndex::Summary summariseGame(std::string file_name)
+{
+    auto summary = saves.GET(file_name);
 
-        try
-        {
-            if (!data["ship"].is_null())
-            {
-                auto ship_name = std::string(data["ship"]["name"]);
-                auto ship_stars = (int)(data["ship"]["stars"]);
-                auto ship_type = static_cast<Ship::Type>((int)(data["ship"]["type"]));
+    if (summary != NULL)
+    {
+        return *summary;
+    }
 
-                character.Ship = Ship::Base(ship_name.c_str(), ship_stars, ship_type);
-            }
-            else
-            {
-                character.Ship = Ship::NONE;
-            }
-        }
-        catch (const std::exception &e)
-        {
-            character.Ship = Ship::NONE;
-        }
+    auto character = loadGame(file_name);
 
-        try
-        {
+    if (character.Epoch == 0)
+    {
+        auto epoch = file_name.substr(file_name.find_last_of("/") + 1, file_name.find_last_of(".") - file_name.find_last_of("/") - 1);
 
 #if defined(_WIN32) || defined(__arm__)
-            character.Epoch = (long long)(data["epoch"]);
+        character.Epoch = std::stoull(epoch);
 #else
-            character.Epoch = (long)(data["epoch"]);
+        character.Epoch = std::stol(epoch);
 #endif
-        }
-        catch (std::exception &ex)
-        {
-            character.Epoch = 0;
-        }
-    }
-    else
-    {
-        character.StoryID = -1;
     }
 
-    return character;
+    return saves.UPDATE(file_name, character);
 }
 
-std::vector<Button> createFilesList(SDL_Window *window, SDL_Renderer *renderer, std::vector<std::string> list, int start, int last, int limit, bool save_button)
+std::vector<Button> createFilesList(SDL_Window *window, SDL_Renderer *renderer, const std::vector<std::string> &list, int start, int last, int limit, bool save_button)
 {
     auto controls = std::vector<Button>();
 
     auto text_space = 8;
 
+    // room on the right of each row for the thumbnail, see gameScreen
+    auto thumbnail_w = (int)(0.125 * SCREEN_HEIGHT * Thumbnail::WIDTH / Thumbnail::HEIGHT);
+
     if (list.size() > 0)
     {
+        auto paths = std::vector<std::string>();
+
+        auto times = std::vector<long long>();
+
         for (int i = 0; i < last - start; i++)
         {
             std::string game_string = "";
 
             auto index = start + i;
 
-            auto character = loadGame(list[index]);
-
-#if defined(_WIN32) || defined(__arm__)
-            long long epoch_long;
-#else
-            long epoch_long;
-#endif
+            auto summary = summariseGame(list[index]);
 
-            if (character.Epoch == 0)
-            {
-                auto epoch = list[index].substr(list[index].find_last_of("/") + 1, list[index].find_last_of(".") - list[index].find_last_of("/") - 1);
+            paths.push_back(list[index]);
 
-#if defined(_WIN32) || defined(__arm__)
-                epoch_long = std::stoull(epoch);
-#else
-                epoch_long = std::stol(epoch);
-#endif
-            }
-            else
-            {
-                epoch_long = character.Epoch;
-            }
+            times.push_back(summary.Time);
 
-            if (character.StoryID != -1)
+            if (summary.Section != -1)
             {
-                auto storyID = std::to_string(std::abs(character.StoryID));
+                auto storyID = std::to_string(std::abs(summary.Section));
 
-                game_string += std::string(4 - std::to_string(index + 1).length(), '0') + std::to_string(index + 1) + ". " + character.Name + "\n";
-                game_string += "Date: " + time_string(epoch_long) + "\n";
+                game_string += std::string(4 - std::to_string(index + 1).length(), '0') + std::to_string(index + 1) + ". " + summary.Name + "\n";
+                game_string += "Date: " + time_string(summary.Epoch) + "\n";
                 game_string += "Section " + std::string(4 - storyID.length(), '0') + storyID + ": ";
-                game_string += "Life: " + std::to_string(character.Life);
-                game_string += ", Money: " + std::to_string(character.Money);
-                game_string += ", Items: " + std::to_string(character.Items.size());
-                game_string += ", Codewords: " + std::to_string(character.Codewords.size());
+                game_string += "Life: " + std::to_string(summary.Life);
+                game_string += ", Money: " + std::to_string(summary.Money);
+                game_string += ", Items: " + std::to_string(summary.Items);
+                game_string += ", Codewords: " + std::to_string(summary.Codewords);
             }
 
-            auto button = createHeaderButton(window, game_string.c_str(), clrWH, intLB, textwidth - 3 * button_space / 2, 0.125 * SCREEN_HEIGHT, text_space);
+            auto button = createHeaderButton(window, game_string.c_str(), clrWH, intLB, textwidth - 3 * button_space / 2 - thumbnail_w - text_space, 0.125 * SCREEN_HEIGHT, text_space);
 
             auto y = (i > 0 ? controls[i - 1].Y + controls[i - 1].H + 3 * text_space : texty + 2 * text_space);
 
@@ -2868,6 +2790,12 @@ std::vector<Button> createFilesList(SDL_Window *window, SDL_Renderer *renderer,
 
             controls[i].H = button->h;
         }
+
+        // keeps what was read for the next time the list is shown
+        saves.SAVE();
+
+        // only the rows in view, rows scrolled past before their thumbnail was read are dropped
+        thumbnails.REQUEST(paths, times);
     }
 
     auto idx = controls.size();
@@ -2894,6 +2822,8 @@ std::vector<Button> createFilesList(SDL_Window *window, SDL_Renderer *renderer,
     if (save_button)
     {
         controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, idx > 0 ? idx - 1 : idx + 1, idx + 1, startx + gridsize, buttony, Control::Type::SAVE));
+
+        controls.push_back(Button(idx + 2, createHeaderButton(window, "Rewind", clrWH, intBK, buttonw, buttonh, -1), idx + 1, idx + 3, idx > 0 ? idx - 1 : idx + 2, idx + 2, startx + 2 * gridsize, buttony, Control::Type::REWIND));
     }
 
     idx = controls.size();
@@ -2910,70 +2840,13 @@ Control::Type gameScreen(SDL_Window *window, SDL_Renderer *renderer, Character::
 
     if (window && renderer)
     {
-#if defined(_WIN32)
-        PWSTR path_str;
-
-        SHGetKnownFolderPath(FOLDERID_Documents, KF_FLAG_DEFAULT, NULL, &path_str);
-
-        std::wstring wpath(path_str);
-
-        CoTaskMemFree(path_str);
-
-        std::string save(wpath.length(), ' ');
-
-        std::copy(wpath.begin(), wpath.end(), save.begin());
-
-        save += "/Saved Games/Down Among the Dead Men";
-
-        std::string path = save + "/";
-#else
-        const char *homedir;
-
-        if ((homedir = getenv("HOME")) == NULL)
-        {
-            homedir = getpwuid(getuid())->pw_dir;
-        }
+        saves.OPEN(saveDirectory());
 
-        std::string save = std::string(homedir) + "/Documents/Saved Games/Down Among the Dead Men";
-        std::string path = save + "/";
-#endif
-
-        fs::create_directories(save);
-
-        std::vector<std::string> entries;
+        // kept up to date by the index as saves come and go, only the saves on screen are ever read, see createFilesList
+        const std::vector<std::string> &entries = saves.FILES();
 
         SDL_Surface *splash = createImage("images/filler1.png");
 
-        auto saved_games = std::multimap<std::filesystem::file_time_type, std::string, std::greater<std::filesystem::file_time_type>>();
-
-        try
-        {
-            for (const auto &entry : fs::directory_iterator(path))
-            {
-                auto time_stamp = entry.last_write_time();
-
-#if defined(_WIN32) || defined(__arm__)
-                std::string file_name = entry.path().string();
-#else
-                std::string file_name = entry.path();
-#endif
-
-                if (file_name.substr(file_name.find_last_of(".") + 1) == "save")
-                {
-                    saved_games.insert(std::make_pair(time_stamp, file_name));
-                }
-            }
-        }
-        catch (std::exception &ex)
-        {
-            std::cerr << "Unable to read save directory!" << std::endl;
-        }
-
-        for (auto const &entry : saved_games)
-        {
-            entries.push_back(entry.second);
-        }
-
         auto font_size = 20;
         auto text_space = 8;
         auto infoh = 0.07 * SCREEN_HEIGHT;
@@ -3030,37 +2903,16 @@ Control::Type gameScreen(SDL_Window *window, SDL_Renderer *renderer, Character::
             {
                 std::string game_string = "";
 
-                auto character = loadGame(entries[selected_file]);
-
-#if defined(_WIN32) || defined(__arm__)
-                long long epoch_long;
-#else
-                long epoch_long;
-#endif
-
-                if (character.Epoch > 0)
-                {
-                    epoch_long = character.Epoch;
-                }
-                else
-                {
-                    auto epoch = entries[selected_file].substr(entries[selected_file].find_last_of("/") + 1, entries[selected_file].find_last_of(".") - entries[selected_file].find_last_of("/") - 1);
-
-#if defined(_WIN32) || defined(__arm__)
-                    epoch_long = std::stoull(epoch);
-#else
-                    epoch_long = std::stol(epoch);
-#endif
-                }
+                auto summary = summariseGame(entries[selected_file]);
 
-                if (character.StoryID != -1)
+                if (summary.Section != -1)
                 {
-                    auto storyID = std::to_string(std::abs(character.StoryID));
+                    auto storyID = std::to_string(std::abs(summary.Section));
 
-                    game_string = "Date: " + time_string(epoch_long) + "\n";
-                    game_string += std::string(4 - storyID.length(), '0') + storyID + ": " + character.Name;
-                    game_string += "\nLife: " + std::to_string(character.Life);
-                    game_string += " Money: " + std::to_string(character.Money);
+                    game_string = "Date: " + time_string(summary.Epoch) + "\n";
+                    game_string += std::string(4 - storyID.length(), '0') + storyID + ": " + summary.Name;
+                    game_string += "\nLife: " + std::to_string(summary.Life);
+                    game_string += " Money: " + std::to_string(summary.Money);
                 }
 
                 putText(renderer, game_string.c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, splashw, 2 * boxh, startx, starty + text_bounds - 2 * boxh);
@@ -3072,8 +2924,24 @@ Control::Type gameScreen(SDL_Window *window, SDL_Renderer *renderer, Character::
 
             if (last - offset > 0)
             {
+                auto thumbnail = Thumbnail::Image();
+
                 for (auto i = 0; i < last - offset; i++)
                 {
+                    auto thumbnail_x = controls[i].X + controls[i].W + text_space;
+
+                    auto thumbnail_w = (int)(boxh * Thumbnail::WIDTH / Thumbnail::HEIGHT);
+
+                    // redrawn as each thumbnail arrives, see Thumbnails::Ready in main
+                    if (thumbnails.GET(entries[offset + i], summariseGame(entries[offset + i]).Time, thumbnail) && !thumbnail.EMPTY())
+                    {
+                        renderThumbnail(renderer, thumbnail, thumbnail_x, controls[i].Y, thumbnail_w, controls[i].H);
+                    }
+                    else
+                    {
+                        fillRect(renderer, thumbnail_w, controls[i].H, thumbnail_x, controls[i].Y, intLB);
+                    }
+
                     if (offset + i == selected_file)
                     {
                         for (auto size = 4; size >= 0; size--)
@@ -3176,6 +3044,14 @@ Control::Type gameScreen(SDL_Window *window, SDL_Renderer *renderer, Character::
                     {
                         player = loadGame(entries[selected_file]);
 
+                        // later saves of the character loaded from a slot go on in the same slot
+                        lineage = SaveSlot::IsSlot(entries[selected_file]) ? entries[selected_file] : std::string();
+
+                        if (fs::path(entries[selected_file]).extension() == Autosave::EXTENSION)
+                        {
+                            recovered = entries[selected_file];
+                        }
+
                         result = Control::Type::LOAD;
 
                         done = true;
@@ -3185,7 +3061,8 @@ Control::Type gameScreen(SDL_Window *window, SDL_Renderer *renderer, Character::
                 }
                 else if (controls[current].Type == Control::Type::SAVE && !hold)
                 {
-                    if (selected_file != -1)
+                    // autosaves belong to their session, saving over one starts a new save instead
+                    if (selected_file != -1 && fs::path(entries[selected_file]).extension() != Autosave::EXTENSION)
                     {
                         saveGame(player, entries[selected_file].c_str());
                     }
@@ -3200,11 +3077,27 @@ Control::Type gameScreen(SDL_Window *window, SDL_Renderer *renderer, Character::
 
                     break;
                 }
-                else if (controls[current].Type == Control::Type::BACK && !hold)
+                else if (controls[current].Type == Control::Type::REWIND && !hold)
                 {
-                    result = Control::Type::BACK;
+                    // one step back is the section before the current one
+                    auto section = -1;
 
-                    done = true;
+                    if (history.REWIND(1, section, player))
+                    {
+                        player.StoryID = section;
+
+                        result = Control::Type::REWIND;
+
+                        done = true;
+
+                        break;
+                    }
+                }
+                else if (controls[current].Type == Control::Type::BACK && !hold)
+                {
+                    result = Control::Type::BACK;
+
+                    done = true;
 
                     break;
                 }
@@ -3301,7 +3194,7 @@ bool tradeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pl
 
             fillRect(renderer, textwidth + arrow_size + button_space, text_bounds, textx, texty, intBE);
 
-            std::string trade_text = "Trade " + std::string(mine.Name) + " for " + std::string(theirs.Name) + "?";
+            std::string trade_text = "Trade " + std::string(mine.Name()) + " for " + std::string(theirs.Name()) + "?";
             putText(renderer, trade_text.c_str(), font, text_space, clrBK, intBE, TTF_STYLE_NORMAL, textwidth, boxh, textx + text_space, texty + text_space);
 
             renderButtons(renderer, controls, current, intGR, text_space, text_space / 2);
@@ -3312,8 +3205,9 @@ bool tradeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pl
             {
                 if (controls[current].Type == Control::Type::ACTION && !hold)
                 {
-                    Character::LOSE_ITEMS(player, {mine.Type});
-                    Character::GET_ITEMS(player, {theirs});
+                    journal.TRADE(mine, theirs);
+
+                    Engine::TRADE(player, mine, theirs);
 
                     done = true;
 
@@ -3347,7 +3241,7 @@ bool tradeScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pl
 
 bool shopScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story, Control::Type mode)
 {
-    auto shop = mode == Control::Type::BUY ? story->Shop : story->Sell;
+    auto &shop = mode == Control::Type::BUY ? story->Shop : story->Sell;
 
     if (shop.size() > 0)
     {
@@ -3369,10 +3263,10 @@ bool shopScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pla
 
         for (auto i = shop.begin(); i != shop.end(); i++)
         {
-            auto item = i->first;
+            auto &item = i->first;
             auto price = i->second;
 
-            std::string choice = item.Name;
+            std::string choice = item.Name();
 
             if (mode == Control::Type::BUY)
             {
@@ -3501,15 +3395,18 @@ bool shopScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pla
                 {
                     if (current >= 0 && current < shop.size())
                     {
-                        auto element = shop.at(current);
-                        auto item = element.first;
-                        auto price = element.second;
+                        auto &item = shop[current].first;
+                        auto price = shop[current].second;
 
                         if (mode == Control::Type::BUY)
                         {
-                            if (player.Money >= price)
+                            journal.BUY(item, price);
+
+                            auto result = Engine::BUY(player, item, price);
+
+                            if (result != Engine::Result::NO_MONEY)
                             {
-                                if (Item::IsUnique(item.Type) && Character::VERIFY_ITEMS(player, {item.Type}))
+                                if (result == Engine::Result::DUPLICATE)
                                 {
                                     message = "You already have this item!";
 
@@ -3521,16 +3418,12 @@ bool shopScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pla
                                 }
                                 else
                                 {
-                                    Character::GET_ITEMS(player, {item});
-
-                                    player.Money -= price;
-
                                     while (!Character::VERIFY_POSSESSIONS(player))
                                     {
                                         inventoryScreen(window, renderer, player, story, player.Items, Control::Type::DROP, 0);
                                     }
 
-                                    std::string description = item.Name;
+                                    std::string description = item.Name();
 
                                     if (item.Charge >= 0)
                                     {
@@ -3570,33 +3463,19 @@ bool shopScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pla
                         }
                         else if (mode == Control::Type::SELL)
                         {
-                            auto result = Item::FIND_TYPE(player.Items, item.Type);
+                            journal.SELL(item, price);
+
+                            auto result = Engine::SELL(player, item, price);
 
-                            if (result >= 0)
+                            if (result == Engine::Result::OK)
                             {
-                                message = std::string(item.Name) + " SOLD.";
+                                message = std::string(item.Name()) + " SOLD.";
 
                                 start_ticks = SDL_GetTicks();
 
                                 purchased = true;
 
                                 error = false;
-
-                                Character::GAIN_MONEY(player, price);
-
-                                if (Item::COUNT_TYPES(player.Items, item.Type) > 1)
-                                {
-                                    auto least = Item::FIND_LEAST(player.Items, item.Type);
-
-                                    if (least >= 0)
-                                    {
-                                        player.Items.erase(player.Items.begin() + least);
-                                    }
-                                }
-                                else
-                                {
-                                    Character::LOSE_ITEMS(player, {item.Type});
-                                }
                             }
                             else
                             {
@@ -3843,6 +3722,38 @@ bool mapScreen(SDL_Window *window, SDL_Renderer *renderer)
     return done;
 }
 
+std::vector<Button> createChoiceControls(std::vector<Choice::Base> &choices, Choice::Availability &available)
+{
+    auto font_size = 20;
+    auto text_space = 8;
+    auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
+
+    auto controls = std::vector<Button>();
+
+    for (int i = 0; i < choices.size(); i++)
+    {
+        // choices that cannot be taken right now are greyed out
+        auto text = createText(choices[i].Text, FONT_FILE, font_size, available[i] ? clrBK : clrGR, textwidth + button_space, TTF_STYLE_NORMAL);
+
+        auto y = (i > 0 ? controls[i - 1].Y + controls[i - 1].H + 3 * text_space : texty + 2 * text_space);
+
+        controls.push_back(Button(i, text, i, i, (i > 0 ? i - 1 : i), (i < choices.size() ? i + 1 : i), textx + 2 * text_space, y, Control::Type::ACTION));
+
+        controls[i].W = textwidth + button_space;
+
+        controls[i].H = text->h;
+    }
+
+    auto idx = choices.size();
+
+    controls.push_back(Button(idx, "icons/map.png", idx - 1, idx + 1, idx - 1, idx, startx, buttony, Control::Type::MAP));
+    controls.push_back(Button(idx + 1, "icons/user.png", idx, idx + 2, idx - 1, idx + 1, startx + gridsize, buttony, Control::Type::CHARACTER));
+    controls.push_back(Button(idx + 2, "icons/items.png", idx + 1, idx + 3, idx - 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::USE));
+    controls.push_back(Button(idx + 3, "icons/back-button.png", idx + 2, idx + 3, idx - 1, idx + 3, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+
+    return controls;
+}
+
 Story::Base *processChoices(SDL_Window *window, SDL_Renderer *renderer, Character::Base &player, Story::Base *story)
 {
     Story::Base *next = &notImplemented;
@@ -3864,7 +3775,7 @@ Story::Base *processChoices(SDL_Window *window, SDL_Renderer *renderer, Characte
             splash = createImage(story->Image);
         }
 
-        auto choices = story->Choices;
+        auto &choices = story->Choices;
 
         auto selected = false;
         auto current = -1;
@@ -3873,8 +3784,6 @@ Story::Base *processChoices(SDL_Window *window, SDL_Renderer *renderer, Characte
         auto scrollDown = false;
         auto hold = false;
 
-        auto controls = std::vector<Button>();
-
         auto font_size = 20;
         auto text_space = 8;
         auto textwidth = ((1 - Margin) * SCREEN_WIDTH) - (textx + arrow_size + button_space) - 2 * text_space;
@@ -3883,25 +3792,11 @@ Story::Base *processChoices(SDL_Window *window, SDL_Renderer *renderer, Characte
         auto infoh = 0.07 * SCREEN_HEIGHT;
         auto box_space = 10;
 
-        for (int i = 0; i < choices.size(); i++)
-        {
-            auto text = createText(choices[i].Text, FONT_FILE, font_size, clrBK, textwidth + button_space, TTF_STYLE_NORMAL);
-
-            auto y = (i > 0 ? controls[i - 1].Y + controls[i - 1].H + 3 * text_space : texty + 2 * text_space);
-
-            controls.push_back(Button(i, text, i, i, (i > 0 ? i - 1 : i), (i < choices.size() ? i + 1 : i), textx + 2 * text_space, y, Control::Type::ACTION));
-
-            controls[i].W = textwidth + button_space;
+        auto available = Choice::EVALUATE(player, choices);
 
-            controls[i].H = text->h;
-        }
+        auto controls = createChoiceControls(choices, available);
 
-        auto idx = choices.size();
-
-        controls.push_back(Button(idx, "icons/map.png", idx - 1, idx + 1, idx - 1, idx, startx, buttony, Control::Type::MAP));
-        controls.push_back(Button(idx + 1, "icons/user.png", idx, idx + 2, idx - 1, idx + 1, startx + gridsize, buttony, Control::Type::CHARACTER));
-        controls.push_back(Button(idx + 2, "icons/items.png", idx + 1, idx + 3, idx - 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::USE));
-        controls.push_back(Button(idx + 3, "icons/back-button.png", idx + 2, idx + 3, idx - 1, idx + 3, (1 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
+        auto warned = false;
 
         TTF_Init();
 
@@ -3972,562 +3867,94 @@ Story::Base *processChoices(SDL_Window *window, SDL_Renderer *renderer, Characte
                 }
             }
 
-            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
+            auto hint = advisor.POLL();
 
-            if (selected && current >= 0 && current < controls.size())
+            if (hint.Section == story->ID)
             {
-                if (controls[current].Type == Control::Type::ACTION && !hold)
+                if (hint.Life > 0 && hint.Choice >= 0 && hint.Choice < story->Choices.size() && hint.Choice != current)
                 {
-                    if (current >= 0 && current < story->Choices.size())
-                    {
-                        if (story->Choices[current].Type == Choice::Type::NORMAL)
-                        {
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::ITEMS)
-                        {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            if (Character::VERIFY_ITEMS(player, items))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                auto loaded = true;
-                                auto weapons = 0;
-
-                                for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                                {
-                                    // Check if items (weapons) are loaded
-                                    if (Item::VERIFY(player.Items, story->Choices[current].Items[i]))
-                                    {
-                                        weapons++;
-
-                                        loaded = false;
-                                    }
-                                }
-
-                                if (!loaded && weapons > 0)
-                                {
-                                    if (weapons > 1)
-                                    {
-                                        message = "The weapons you are carrying are not loaded!";
-                                    }
-                                    else
-                                    {
-                                        message = "The weapon you are carrying is not loaded!";
-                                    }
-                                }
-                                else
-                                {
-                                    if (story->Choices[current].Items.size() > 1)
-                                    {
-                                        message = "You do not have the required items!";
-                                    }
-                                    else
-                                    {
-                                        message = "You do not have the required item!";
-                                    }
-                                }
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::ANY_ITEM)
-                        {
-                            if (Character::VERIFY_ITEMS_ANY(player, story->Choices[current].Items))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "You do not have any of the required items that can be used.";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::CODEWORD)
-                        {
-                            if (Character::VERIFY_CODEWORD(player, story->Choices[current].Codeword))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "You do not have the required codeword!";
+                    drawRect(renderer, controls[hint.Choice].W + 2 * text_space, controls[hint.Choice].H + 2 * text_space, controls[hint.Choice].X - text_space, controls[hint.Choice].Y - text_space, intGN);
+                }
+                else if (hint.Proven && hint.Life < 0 && !warned && !error)
+                {
+                    message = "You can no longer win this adventure!";
 
-                                start_ticks = SDL_GetTicks();
+                    start_ticks = SDL_GetTicks();
 
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::GET_ITEMS)
-                        {
-                            Character::GET_ITEMS(player, {story->Choices[current].Items});
+                    error = true;
 
-                            while (!Character::VERIFY_POSSESSIONS(player))
-                            {
-                                inventoryScreen(window, renderer, player, story, player.Items, Control::Type::DROP, 0);
-                            }
+                    warned = true;
+                }
+            }
 
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
+            done = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
 
-                            done = true;
+            if (selected && current >= 0 && current < controls.size())
+            {
+                if (controls[current].Type == Control::Type::ACTION && !hold)
+                {
+                    if (current >= 0 && current < story->Choices.size())
+                    {
+                        auto &choice = story->Choices[current];
 
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::TAKE)
+                        if (!available[current])
                         {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            Character::LOSE_ITEMS(player, items);
-
-                            auto finished = false;
+                            message = Choice::REASON(player, choice);
 
-                            while (!finished)
-                            {
-                                finished = takeScreen(window, renderer, player, story->Choices[current].Items, story->Choices[current].Value, false);
-                            }
-
-                            while (!Character::VERIFY_POSSESSIONS(player))
-                            {
-                                inventoryScreen(window, renderer, player, story, player.Items, Control::Type::DROP, 0);
-                            }
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
+                            start_ticks = SDL_GetTicks();
 
-                            break;
+                            error = true;
                         }
-                        else if (story->Choices[current].Type == Choice::Type::PAY_WITH)
+                        else
                         {
-                            if (story->Choices[current].Items.size() > 0)
-                            {
-                                int count = Item::COUNT_TYPES(player.Items, story->Choices[current].Items[0].Type);
-
-                                if (count >= story->Choices[current].Value)
-                                {
-                                    for (auto i = 0; i < story->Choices[current].Value; i++)
-                                    {
-                                        Character::LOSE_ITEMS(player, {story->Choices[current].Items[0].Type});
-                                    }
-
-                                    next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                    done = true;
-
-                                    break;
-                                }
-                                else
-                                {
-                                    message = "You do not have the enough!";
+                            journal.CHOICE(current);
 
-                                    start_ticks = SDL_GetTicks();
+                            auto interaction = Choice::APPLY(player, choice);
 
-                                    error = true;
-                                }
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::SELL)
-                        {
-                            if (story->Choices[current].Items.size() > 0)
+                            if (interaction == Choice::Interaction::TAKE)
                             {
-                                int count = Item::COUNT_TYPES(player.Items, story->Choices[current].Items[0].Type);
-
-                                if (count > 0)
-                                {
-                                    Character::LOSE_ITEMS(player, {story->Choices[current].Items[0].Type});
+                                auto finished = false;
 
-                                    Character::GAIN_MONEY(player, story->Choices[current].Value);
-
-                                    next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                    done = true;
-
-                                    break;
-                                }
-                                else
+                                while (!finished)
                                 {
-                                    message = "You do not have that!";
-
-                                    start_ticks = SDL_GetTicks();
-
-                                    error = true;
+                                    finished = takeScreen(window, renderer, player, choice.Items, choice.Value, false);
                                 }
                             }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::LOSE_ITEMS)
-                        {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            if (Character::VERIFY_ITEMS(player, items))
-                            {
-                                Character::LOSE_ITEMS(player, items);
-
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "You do not have the required item!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::GIVE)
-                        {
-                            if (player.Items.size() >= story->Choices[current].Value)
+                            else if (interaction == Choice::Interaction::GIVE)
                             {
-                                auto limit = player.Items.size() - story->Choices[current].Value;
+                                auto limit = player.Items.size() - choice.Value;
 
                                 while (player.Items.size() > limit)
                                 {
                                     inventoryScreen(window, renderer, player, story, player.Items, Control::Type::LOSE, limit);
                                 }
-
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else if (player.Items.size() > 0)
-                            {
-                                Character::LOSE_POSSESSIONS(player);
-
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
                             }
-                            else if (player.Items.size() == 0)
+                            else if (interaction == Choice::Interaction::BRIBE)
                             {
-                                message = "You do not have anything to give!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
+                                loseItems(window, renderer, player, Choice::TYPES(choice), choice.Value);
                             }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::BRIBE)
-                        {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
+                            else if (interaction == Choice::Interaction::LOSE_SKILLS)
                             {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            loseItems(window, renderer, player, items, story->Choices[current].Value);
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::GET_CODEWORD)
-                        {
-                            Character::GET_CODEWORDS(player, {story->Choices[current].Codeword});
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::LOSE_CODEWORD)
-                        {
-                            Character::REMOVE_CODEWORD(player, story->Choices[current].Codeword);
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
+                                auto result = loseSkills(window, renderer, player, choice.Value);
 
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::LOSE_ALL)
-                        {
-                            Character::LOSE_ALL(player);
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::LOSE_MONEY)
-                        {
-                            if (player.Money >= story->Choices[current].Value)
-                            {
-                                player.Money -= story->Choices[current].Value;
-
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "You do not have enough money!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::GAIN_MONEY)
-                        {
-                            player.Money += story->Choices[current].Value;
-
-                            next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::MONEY)
-                        {
-                            if (player.Money >= story->Choices[current].Value)
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                message = "You do not have enough money!";
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::LIFE)
-                        {
-                            Character::GAIN_LIFE(player, story->Choices[current].Value);
-
-                            if (player.Life > 0)
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-                            }
-
-                            done = true;
-
-                            break;
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::SKILL_ANY)
-                        {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            if (Character::VERIFY_SKILL_ANY(player, story->Choices[current].Skill, items))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                if (Character::HAS_SKILL(player, story->Choices[current].Skill))
-                                {
-                                    message = "You do not have any of the required item to use with this skill!";
-                                }
-                                else
-                                {
-                                    message = "You do not possess the required skill!";
-                                }
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::SKILL)
-                        {
-                            if (Character::VERIFY_SKILL(player, story->Choices[current].Skill))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                if (Character::HAS_SKILL(player, story->Choices[current].Skill))
-                                {
-                                    auto result = Character::FIND_SKILL(player, story->Choices[current].Skill);
-
-                                    auto item = player.Skills[result].Requirement;
-
-                                    if (Item::FIND_TYPE(player.Items, item) >= 0)
-                                    {
-                                        message = "The item you are carrying is not loaded!";
-                                    }
-                                    else
-                                    {
-                                        message = "You do not have the required item to use with this skill!";
-                                    }
-                                }
-                                else
-                                {
-                                    message = "You do not possess the required skill!";
-                                }
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
-                            }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::SKILL_ANY)
-                        {
-                            auto items = std::vector<Item::Type>();
-
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            if (Character::VERIFY_SKILL_ANY(player, story->Choices[current].Skill, items))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
-                            {
-                                if (Character::HAS_SKILL(player, story->Choices[current].Skill))
-                                {
-                                    message = "You do not have any of the required item to use with this skill!";
-                                }
-                                else
+                                if (!result || player.Skills.size() > choice.Value)
                                 {
-                                    message = "You do not possess the required skill!";
+                                    continue;
                                 }
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
                             }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::SKILL_ITEM)
-                        {
-                            auto items = std::vector<Item::Type>();
 
-                            for (auto i = 0; i < story->Choices[current].Items.size(); i++)
-                            {
-                                items.push_back(story->Choices[current].Items[i].Type);
-                            }
-
-                            if (Character::HAS_SKILL(player, story->Choices[current].Skill) && Character::VERIFY_ITEMS(player, items))
-                            {
-                                next = (Story::Base *)findStory(story->Choices[current].Destination);
-
-                                done = true;
-
-                                break;
-                            }
-                            else
+                            while (!Character::VERIFY_POSSESSIONS(player))
                             {
-                                if (Character::HAS_SKILL(player, story->Choices[current].Skill))
-                                {
-                                    message = "You do not have the required item!";
-                                }
-                                else
-                                {
-                                    message = "You do not possess the required skill!";
-                                }
-
-                                start_ticks = SDL_GetTicks();
-
-                                error = true;
+                                inventoryScreen(window, renderer, player, story, player.Items, Control::Type::DROP, 0);
                             }
-                        }
-                        else if (story->Choices[current].Type == Choice::Type::LOSE_SKILLS)
-                        {
-                            int limit = story->Choices[current].Value;
 
-                            auto result = loseSkills(window, renderer, player, limit);
-
-                            if (!result)
-                            {
-                                continue;
-                            }
-                            else
-                            {
-                                if (player.Skills.size() <= limit)
-                                {
-                                    auto nextID = story->Choices[current].Destination;
+                            next = Engine::DESTINATION(player, story, choice);
 
-                                    if (nextID != story->ID)
-                                    {
-                                        next = (Story::Base *)findStory(nextID);
-                                    }
-                                    else
-                                    {
-                                        next = story;
-                                    }
+                            journal.DESTINATION(next->ID);
 
-                                    done = true;
+                            done = true;
 
-                                    break;
-                                }
-                            }
+                            break;
                         }
                     }
                 }
@@ -4543,6 +3970,11 @@ Story::Base *processChoices(SDL_Window *window, SDL_Renderer *renderer, Characte
                 {
                     inventoryScreen(window, renderer, player, story, player.Items, Control::Type::USE, 0);
 
+                    // items used from the inventory may open up other choices
+                    available = Choice::EVALUATE(player, choices);
+
+                    controls = createChoiceControls(choices, available);
+
                     current = -1;
 
                     selected = false;
@@ -4593,7 +4025,7 @@ Story::Base *processChoices(SDL_Window *window, SDL_Renderer *renderer, Characte
     return next;
 }
 
-std::vector<Button> createSkillControls(std::vector<Skill::Base> Skills)
+std::vector<Button> createSkillControls(Skill::List &Skills)
 {
     auto font_size = 20;
     auto text_space = 8;
@@ -4748,6 +4180,8 @@ bool loseSkills(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pla
                             skills.push_back(selection[i].Type);
                         }
 
+                        journal.LOSE_SKILLS(skills);
+
                         Character::LOSE_SKILLS(player, skills);
 
                         done = true;
@@ -4800,6 +4234,8 @@ Story::Base *renderChoices(SDL_Window *window, SDL_Renderer *renderer, Character
     else
     {
         next = (Story::Base *)findStory(story->Continue(player));
+
+        journal.CONTINUE(next->ID);
     }
 
     return next;
@@ -4857,6 +4293,12 @@ bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &p
         // capture player state before running the story
         saveCharacter = player;
 
+        history.PUSH(story->ID, saveCharacter);
+
+        autosave.RECORD(saveCharacter);
+
+        advisor.REQUEST(story->ID, saveCharacter);
+
         auto run_once = true;
 
         SDL_Surface *splash = NULL;
@@ -4867,16 +4309,11 @@ bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &p
         {
             run_once = false;
 
-            auto jump = story->Background(player);
-
-            if (jump >= 0)
-            {
-                story = (Story::Base *)findStory(jump);
+            auto from = story->ID;
 
-                continue;
-            }
+            story = Engine::ENTER(player, story);
 
-            story->Event(player);
+            journal.ENTER(from, story->ID);
         }
 
         int splash_h = 250;
@@ -4945,8 +4382,37 @@ bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &p
             auto current = -1;
             auto offset = 0;
 
+            // the game screen waits for the story to be drawn once more so it can be read back for the save, see below
+            auto capture = false;
+
             while (!quit)
             {
+                auto job = SaveFile::Job();
+
+                while (saver.POLL(job))
+                {
+                    if (job.Saved)
+                    {
+                        saves.UPDATE(job.File, job.Player);
+
+                        saves.SAVE();
+
+                        message = "Game saved!";
+
+                        flash_color = intLB;
+                    }
+                    else
+                    {
+                        message = "Unable to save the game!";
+
+                        flash_color = intRD;
+                    }
+
+                    start_ticks = SDL_GetTicks();
+
+                    flash_message = true;
+                }
+
                 if (story->Title)
                 {
                     SDL_SetWindowTitle(window, story->Title);
@@ -5079,7 +4545,18 @@ bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &p
                     putText(renderer, "You have avenged your honour and saved the Queen. Further adventure awaits!", font, text_space, clrWH, intLB, TTF_STYLE_NORMAL, splashw, messageh, startx, starty);
                 }
 
-                quit = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
+                if (capture)
+                {
+                    // read before GetInput presents it, SDL leaves the back buffer undefined once it has been shown
+                    screenshot = captureScreen(renderer);
+
+                    // goes on to the game screen with the same button still selected
+                    selected = true;
+                }
+                else
+                {
+                    quit = Input::GetInput(renderer, controls, current, selected, scrollUp, scrollDown, hold);
+                }
 
                 if (((selected && current >= 0 && current < controls.size()) || scrollUp || scrollDown || hold))
                 {
@@ -5163,21 +4640,17 @@ bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &p
 
                         selected = false;
                     }
+                    else if (controls[current].Type == Control::Type::GAME && !hold && !capture)
+                    {
+                        capture = true;
+                    }
                     else if (controls[current].Type == Control::Type::GAME && !hold)
                     {
-                        auto result = gameScreen(window, renderer, saveCharacter, true);
+                        capture = false;
 
-                        if (result == Control::Type::SAVE)
-                        {
-                            message = "Game saved!";
-
-                            start_ticks = SDL_GetTicks();
-
-                            flash_message = true;
+                        auto result = gameScreen(window, renderer, saveCharacter, true);
 
-                            flash_color = intLB;
-                        }
-                        else if (result == Control::Type::LOAD)
+                        if (result == Control::Type::LOAD)
                         {
                             if (saveCharacter.StoryID >= 0 && saveCharacter.Life > 0)
                             {
@@ -5185,6 +4658,10 @@ bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &p
 
                                 story = (Story::Base *)findStory(saveCharacter.StoryID);
 
+                                history.CLEAR();
+
+                                journal.START(player, story->ID);
+
                                 message = "Game loaded!";
 
                                 start_ticks = SDL_GetTicks();
@@ -5196,6 +4673,25 @@ bool processStory(SDL_Window *window, SDL_Renderer *renderer, Character::Base &p
                                 break;
                             }
                         }
+                        else if (result == Control::Type::REWIND)
+                        {
+                            // the snapshot is the character as they entered that section, so its event runs once more and nothing in between does
+                            player = saveCharacter;
+
+                            story = (Story::Base *)findStory(saveCharacter.StoryID);
+
+                            journal.START(player, story->ID);
+
+                            message = "Rewound!";
+
+                            start_ticks = SDL_GetTicks();
+
+                            flash_message = true;
+
+                            flash_color = intLB;
+
+                            break;
+                        }
 
                         current = -1;
 
@@ -5345,7 +4841,34 @@ bool storyScreen(SDL_Window *window, SDL_Renderer *renderer, Character::Base &pl
 {
     auto story = (Story::Base *)findStory(id);
 
-    return processStory(window, renderer, player, story);
+    auto epoch = std::chrono::system_clock::now().time_since_epoch() / std::chrono::milliseconds(1);
+
+    history.CLEAR();
+
+    if (journal.OPEN(saveDirectory() + "/" + std::to_string(epoch) + ".journal"))
+    {
+        journal.START(player, story->ID);
+    }
+
+    autosave.OPEN(saveDirectory() + "/" + std::to_string(epoch) + Autosave::EXTENSION);
+
+    auto result = processStory(window, renderer, player, story);
+
+    journal.CLOSE();
+
+    // autosaves are only there to recover from a crash, one per session would otherwise pile up
+    autosave.REMOVE();
+
+    if (!recovered.empty())
+    {
+        auto error = std::error_code();
+
+        fs::remove(recovered, error);
+
+        recovered.clear();
+    }
+
+    return result;
 }
 
 bool mainScreen(SDL_Window *window, SDL_Renderer *renderer, int storyID)
@@ -5362,6 +4885,9 @@ bool mainScreen(SDL_Window *window, SDL_Renderer *renderer, int storyID)
 
     InitializeStories();
 
+    // the only full look at the save directory, the index follows it from here on
+    saves.OPEN(saveDirectory());
+
     Character::Base Player;
 
     // Render window
@@ -5434,6 +4960,8 @@ bool mainScreen(SDL_Window *window, SDL_Renderer *renderer, int storyID)
 
                     Player = selectCharacter(window, renderer);
 
+                    lineage.clear();
+
                     if (Player.StoryID != -1)
                     {
                         storyScreen(window, renderer, Player, storyID);
@@ -5514,6 +5042,16 @@ int main(int argc, char **argv)
 
     createWindow(SDL_INIT_VIDEO, &window, &renderer, title, "icons/pirate-ship.png");
 
+    // wakes the load screen so that thumbnails show up as they are read
+    thumbnails.Ready = []()
+    {
+        SDL_Event event;
+
+        event.type = SDL_USEREVENT;
+
+        SDL_PushEvent(&event);
+    };
+
     auto numGamePads = Input::InitializeGamePads();
 
     auto quit = false;
@@ -5527,7 +5065,25 @@ int main(int argc, char **argv)
 
     if (window)
     {
-        quit = mainScreen(window, renderer, storyID);
+        if (argc > 2 && std::string(argv[1]) == "--replay")
+        {
+            // fast-forward through a session journal and pick the game up at the last section it reached
+            auto replay = Journal::REPLAY(Journal::READ(argv[2]));
+
+            if (!replay.Error.empty())
+            {
+                std::cerr << "Replay stopped after " << replay.Records << " records: " << replay.Error << std::endl;
+            }
+
+            if (replay.CheckpointSection >= 0)
+            {
+                quit = storyScreen(window, renderer, replay.Checkpoint, replay.CheckpointSection);
+            }
+        }
+        else
+        {
+            quit = mainScreen(window, renderer, storyID);
+        }
 
         // Destroy window and renderer
         SDL_DestroyRenderer(renderer);
@@ -0,0 +1,202 @@
+#ifndef __AUTOPLAY__HPP__
+#define __AUTOPLAY__HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "character.hpp"
+#include "engine.hpp"
+
+// Random games played end to end, used as a load generator and to shake out sections that fail or loop
+namespace Autoplay
+{
+    // a game that threw, with what is needed to play it again
+    class Failure
+    {
+    public:
+        long long Game = 0;
+
+        // index into Character::Archetypes
+        int Class = 0;
+
+        int Section = 0;
+
+        std::string What = std::string();
+
+        Failure(long long game, int character, int section, const char *what) : Game(game), Class(character), Section(section), What(what)
+        {
+        }
+    };
+
+    class Report
+    {
+    public:
+        long long Games = 0;
+
+        // options applied over all games
+        long long Steps = 0;
+
+        // sections entered over all games
+        long long Sections = 0;
+
+        // endings reached per starting class, indexed by Character::Archetypes then Engine::Ending
+        std::vector<std::vector<long long>> Endings = std::vector<std::vector<long long>>(Character::Archetypes.size(), std::vector<long long>((int)Engine::Ending::Last + 1, 0));
+
+        // times each section was entered
+        std::map<int, long long> Visits = std::map<int, long long>();
+
+        std::vector<Autoplay::Failure> Failures = std::vector<Autoplay::Failure>();
+
+        void MERGE(const Autoplay::Report &other)
+        {
+            Games += other.Games;
+
+            Steps += other.Steps;
+
+            Sections += other.Sections;
+
+            for (auto i = 0; i < Endings.size(); i++)
+            {
+                for (auto j = 0; j < Endings[i].size(); j++)
+                {
+                    Endings[i][j] += other.Endings[i][j];
+                }
+            }
+
+            for (auto &visit : other.Visits)
+            {
+                Visits[visit.first] += visit.second;
+            }
+
+            Failures.insert(Failures.end(), other.Failures.begin(), other.Failures.end());
+        }
+
+        // the most entered sections, most visits first
+        std::vector<std::pair<int, long long>> TOP(int count) const
+        {
+            auto top = std::vector<std::pair<int, long long>>(Visits.begin(), Visits.end());
+
+            std::sort(top.begin(), top.end(), [](const std::pair<int, long long> &a, const std::pair<int, long long> &b)
+                      { return a.second > b.second || (a.second == b.second && a.first < b.first); });
+
+            if (top.size() > count)
+            {
+                top.resize(count);
+            }
+
+            return top;
+        }
+    };
+
+    // game number n always plays the same class with the same random answers, whatever the number of threads
+    void PLAY(Autoplay::Report &report, long long game, std::uint64_t seed, int limit)
+    {
+        auto character = (int)(game % Character::Archetypes.size());
+
+        auto random = std::mt19937_64(seed + (std::uint64_t)game);
+
+        auto session = Engine::Session();
+
+        auto steps = 0;
+
+        auto sections = 0;
+
+        try
+        {
+            Engine::START(session, Character::Archetypes[character], 0);
+
+            while (session.Prompt != Engine::Prompt::END)
+            {
+                if (session.Sections != sections)
+                {
+                    sections = session.Sections;
+
+                    report.Visits[session.Section->ID]++;
+                }
+
+                if (steps >= limit)
+                {
+                    Engine::STOP(session, Engine::Ending::LOOP);
+
+                    break;
+                }
+
+                auto options = Engine::OPTIONS(session);
+
+                if (options.size() == 0)
+                {
+                    Engine::STOP(session, Engine::Ending::STUCK);
+
+                    break;
+                }
+
+                Engine::APPLY(session, options[std::uniform_int_distribution<int>(0, options.size() - 1)(random)]);
+
+                steps++;
+            }
+
+            report.Endings[character][(int)session.Ending]++;
+        }
+        catch (const std::exception &e)
+        {
+            report.Failures.push_back(Autoplay::Failure(game, character, session.Section ? session.Section->ID : 0, e.what()));
+        }
+
+        report.Games++;
+
+        report.Steps += steps;
+
+        report.Sections += session.Sections;
+    }
+
+    void RUN(Autoplay::Report &report, std::atomic<long long> &next, long long games, std::uint64_t seed, int limit)
+    {
+        for (auto game = next++; game < games; game = next++)
+        {
+            Autoplay::PLAY(report, game, seed, limit);
+        }
+    }
+
+    // plays games on worker threads, limit caps the options applied per game before it counts as a loop
+    Autoplay::Report AUTOPLAY(long long games, std::uint64_t seed, int threads, int limit)
+    {
+        threads = std::max(1, threads);
+
+        auto next = std::atomic<long long>(0);
+
+        auto reports = std::vector<Autoplay::Report>(threads);
+
+        auto workers = std::vector<std::thread>();
+
+        for (auto i = 0; i < threads; i++)
+        {
+            workers.push_back(std::thread(Autoplay::RUN, std::ref(reports[i]), std::ref(next), games, seed, limit));
+        }
+
+        for (auto i = 0; i < workers.size(); i++)
+        {
+            workers[i].join();
+        }
+
+        auto report = Autoplay::Report();
+
+        for (auto i = 0; i < reports.size(); i++)
+        {
+            report.MERGE(reports[i]);
+        }
+
+        return report;
+    }
+
+} // namespace Autoplay
+
+#endif
@@ -0,0 +1,315 @@
+#ifndef __AUTOSAVE__HPP__
+#define __AUTOSAVE__HPP__
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+#include "binary.hpp"
+#include "character.hpp"
+#include "rewind.hpp"
+#include "savefile.hpp"
+
+// The character as they enter each section, appended to a file as the fields that changed since the previous section
+// and folded back into one snapshot every so often, so that a crash loses at most the section being read
+namespace Autosave
+{
+    enum class Record
+    {
+        SNAPSHOT = 0,
+        DELTA,
+        First = SNAPSHOT,
+        Last = DELTA
+    };
+
+    constexpr const char *Records[] = {"SNAPSHOT", "DELTA"};
+
+    static_assert(sizeof(Autosave::Records) / sizeof(const char *) == (int)Autosave::Record::Last + 1, "every record needs its own entry in Autosave::Records, in enum order");
+
+    const char MAGIC[] = "DMA";
+
+    const int VERSION = 1;
+
+    const char EXTENSION[] = ".autosave";
+
+    // record type, payload length, payload and a checksum of all three, so a record cut short by a crash is recognised
+    std::string FRAME(Autosave::Record type, const std::string &payload)
+    {
+        auto writer = Binary::Writer();
+
+        writer.BYTE((int)type);
+
+        writer.UNSIGNED(payload.size());
+
+        writer.Bytes += payload;
+
+        writer.FIXED32(Binary::CRC32((const std::uint8_t *)writer.Bytes.data(), writer.Bytes.size()));
+
+        return writer.Bytes;
+    }
+
+    std::string HEADER()
+    {
+        auto header = std::string(Autosave::MAGIC, sizeof(Autosave::MAGIC) - 1);
+
+        header.push_back((char)Autosave::VERSION);
+
+        return header;
+    }
+
+    class Writer
+    {
+    public:
+        std::FILE *File = NULL;
+
+        std::string FileName = std::string();
+
+        // fields of the last record written, deltas are taken against them
+        Rewind::Fields Last = Rewind::Fields();
+
+        // deltas written since the snapshot at the start of the file
+        int Deltas = 0;
+
+        // deltas allowed before the file is compacted into a single snapshot
+        int Interval = 64;
+
+        Writer()
+        {
+        }
+
+        ~Writer()
+        {
+            CLOSE();
+        }
+
+        bool OPEN(const std::string &file_name)
+        {
+            CLOSE();
+
+            FileName = file_name;
+
+            File = std::fopen(file_name.c_str(), "ab");
+
+            if (File)
+            {
+                std::setvbuf(File, NULL, _IOFBF, 1 << 12);
+
+                if (std::ftell(File) == 0)
+                {
+                    auto header = Autosave::HEADER();
+
+                    std::fwrite(header.data(), 1, header.size(), File);
+                }
+            }
+
+            // whatever the file held before, the next record is a snapshot
+            Last.clear();
+
+            Deltas = 0;
+
+            return File != NULL;
+        }
+
+        // replaces the file with a single snapshot of the last character recorded
+        bool COMPACT()
+        {
+            if (!File || Last.empty())
+            {
+                return false;
+            }
+
+            std::fclose(File);
+
+            auto compacted = SaveFile::COMMIT(FileName, Autosave::HEADER() + Autosave::FRAME(Autosave::Record::SNAPSHOT, Rewind::PACK(Last)));
+
+            File = std::fopen(FileName.c_str(), "ab");
+
+            Deltas = 0;
+
+            return compacted && File != NULL;
+        }
+
+        // the character as they enter a section, StoryID already set
+        void RECORD(const Character::Base &player)
+        {
+            if (!File)
+            {
+                return;
+            }
+
+            auto fields = Binary::Writer::FIELDS(player);
+
+            if (Last.empty())
+            {
+                auto frame = Autosave::FRAME(Autosave::Record::SNAPSHOT, Rewind::PACK(fields));
+
+                std::fwrite(frame.data(), 1, frame.size(), File);
+
+                std::fflush(File);
+
+                Last = fields;
+            }
+            else
+            {
+                auto frame = Autosave::FRAME(Autosave::Record::DELTA, Rewind::DELTA(Last, fields));
+
+                std::fwrite(frame.data(), 1, frame.size(), File);
+
+                std::fflush(File);
+
+                Last = fields;
+
+                Deltas++;
+
+                if (Deltas >= Interval)
+                {
+                    COMPACT();
+                }
+            }
+        }
+
+        // leaves the file as a single snapshot
+        void CLOSE()
+        {
+            if (File)
+            {
+                if (Deltas > 0)
+                {
+                    COMPACT();
+                }
+
+                if (File)
+                {
+                    std::fclose(File);
+                }
+
+                File = NULL;
+            }
+
+            Last.clear();
+
+            Deltas = 0;
+        }
+
+        // the session ended without a crash, so there is nothing left to recover
+        void REMOVE()
+        {
+            if (File)
+            {
+                std::fclose(File);
+
+                File = NULL;
+            }
+
+            if (!FileName.empty())
+            {
+                auto error = std::error_code();
+
+                std::filesystem::remove(FileName, error);
+            }
+
+            FileName.clear();
+
+            Last.clear();
+
+            Deltas = 0;
+        }
+    };
+
+    // what could be recovered from an autosave
+    class Recovery
+    {
+    public:
+        Character::Base Player = Character::Base();
+
+        // records read before the end of the file or the first damaged one
+        int Records = 0;
+
+        // bytes after the last good record, a crash in the middle of an append leaves some
+        std::size_t Discarded = 0;
+
+        bool Good = false;
+    };
+
+    // the last snapshot with every delta after it applied, up to the first record that is incomplete or damaged
+    Autosave::Recovery RECOVER(const std::string &bytes)
+    {
+        auto recovery = Autosave::Recovery();
+
+        auto header = Autosave::HEADER();
+
+        if (bytes.compare(0, header.size(), header) != 0)
+        {
+            recovery.Discarded = bytes.size();
+
+            return recovery;
+        }
+
+        auto reader = Binary::Reader(bytes);
+
+        reader.Position = header.size();
+
+        auto fields = Rewind::Fields();
+
+        while (!reader.END())
+        {
+            auto start = reader.Position;
+
+            auto type = reader.BYTE();
+
+            auto length = reader.LENGTH();
+
+            auto payload = reader.Position;
+
+            reader.Position += length;
+
+            auto end = reader.Position;
+
+            auto crc = reader.FIXED32();
+
+            if (!reader.Good || type > (int)Autosave::Record::Last || crc != Binary::CRC32((const std::uint8_t *)bytes.data() + start, end - start))
+            {
+                reader.Position = start;
+
+                break;
+            }
+
+            if (type == (int)Autosave::Record::SNAPSHOT)
+            {
+                fields = Rewind::UNPACK(bytes.substr(payload, length));
+            }
+            else if (!fields.empty())
+            {
+                fields = Rewind::PATCH(fields, bytes.substr(payload, length));
+            }
+
+            recovery.Records++;
+        }
+
+        recovery.Discarded = bytes.size() - std::min(bytes.size(), reader.Position);
+
+        if (!fields.empty())
+        {
+            auto character = std::string();
+
+            for (auto i = 0; i < fields.size(); i++)
+            {
+                character += fields[i];
+            }
+
+            auto decoder = Binary::Reader(character);
+
+            recovery.Player = decoder.CHARACTER();
+
+            recovery.Good = decoder.Good;
+        }
+
+        return recovery;
+    }
+
+} // namespace Autosave
+
+#endif
@@ -0,0 +1,434 @@
+#ifndef __BINARY__HPP__
+#define __BINARY__HPP__
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "character.hpp"
+
+// Compact encoding of game data: integers are zigzag varints, lists are prefixed with their length
+namespace Binary
+{
+    // CRC-32 as used by zip and PNG, crc continues a checksum over data that comes in pieces
+    std::uint32_t CRC32(const std::uint8_t *data, std::size_t size, std::uint32_t crc = 0)
+    {
+        static const auto table = []()
+        {
+            auto table = std::array<std::uint32_t, 256>();
+
+            for (auto i = 0; i < 256; i++)
+            {
+                auto value = (std::uint32_t)i;
+
+                for (auto bit = 0; bit < 8; bit++)
+                {
+                    value = (value & 1) ? 0xEDB88320 ^ (value >> 1) : value >> 1;
+                }
+
+                table[i] = value;
+            }
+
+            return table;
+        }();
+
+        crc = ~crc;
+
+        for (auto i = 0; i < size; i++)
+        {
+            crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        }
+
+        return ~crc;
+    }
+
+    class Writer
+    {
+    public:
+        std::string Bytes = std::string();
+
+        void BYTE(std::uint8_t value)
+        {
+            Bytes.push_back((char)value);
+        }
+
+        void UNSIGNED(std::uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                Bytes.push_back((char)(value | 0x80));
+
+                value >>= 7;
+            }
+
+            Bytes.push_back((char)value);
+        }
+
+        // four bytes, least significant first, for values that have to be patched in place
+        void FIXED32(std::uint32_t value)
+        {
+            for (auto i = 0; i < 4; i++)
+            {
+                Bytes.push_back((char)(value >> (8 * i)));
+            }
+        }
+
+        void INT(std::int64_t value)
+        {
+            UNSIGNED(((std::uint64_t)value << 1) ^ (std::uint64_t)(value >> 63));
+        }
+
+        void STRING(const char *text)
+        {
+            auto length = std::char_traits<char>::length(text);
+
+            UNSIGNED(length);
+
+            Bytes.append(text, length);
+        }
+
+        void ITEM(const Item::Base &item)
+        {
+            INT((int)item.Type);
+
+            INT((int)item.Variant);
+
+            INT(item.Charge);
+        }
+
+        template <typename T>
+        void ITEMS(const T &items)
+        {
+            UNSIGNED(items.size());
+
+            for (auto i = 0; i < items.size(); i++)
+            {
+                ITEM(items[i]);
+            }
+        }
+
+        template <typename T>
+        void SKILLS(const T &skills)
+        {
+            UNSIGNED(skills.size());
+
+            for (auto i = 0; i < skills.size(); i++)
+            {
+                INT((int)skills[i].Type);
+            }
+        }
+
+        // any list of ints or enums
+        template <typename T>
+        void VALUES(const T &values)
+        {
+            UNSIGNED(values.size());
+
+            for (auto i = 0; i < values.size(); i++)
+            {
+                INT((int)values[i]);
+            }
+        }
+
+        // the character one field at a time, each encoded on its own
+        static std::vector<std::string> FIELDS(const Character::Base &player)
+        {
+            auto fields = std::vector<std::string>();
+
+            auto field = Binary::Writer();
+
+            auto next = [&]()
+            {
+                fields.push_back(std::move(field.Bytes));
+
+                field.Bytes.clear();
+            };
+
+            field.STRING(player.Name);
+            next();
+            field.STRING(player.Description);
+            next();
+            field.INT((int)player.Type);
+            next();
+            field.INT(player.Life);
+            next();
+            field.INT(player.Money);
+            next();
+            field.INT(player.ITEM_LIMIT);
+            next();
+            field.INT(player.MAX_LIFE_LIMIT);
+            next();
+            field.INT(player.SKILLS_LIMIT);
+            next();
+            field.INT(player.LostMoney);
+            next();
+            field.INT(player.StoryID);
+            next();
+            field.INT(player.Epoch);
+            next();
+            field.INT((int)player.Ship.Type);
+            next();
+            field.INT(player.Ship.Stars);
+            next();
+            field.SKILLS(player.Skills);
+            next();
+            field.SKILLS(player.LostSkills);
+            next();
+            field.SKILLS(player.TemporarySkills);
+            next();
+            field.ITEMS(player.Items);
+            next();
+            field.ITEMS(player.LostItems);
+            next();
+            field.VALUES(player.Codewords);
+            next();
+
+            return fields;
+        }
+
+        // the fields back to back, read by Reader::CHARACTER
+        void CHARACTER(const Character::Base &player)
+        {
+            auto fields = Binary::Writer::FIELDS(player);
+
+            for (auto i = 0; i < fields.size(); i++)
+            {
+                Bytes += fields[i];
+            }
+        }
+    };
+
+    // reads back what Writer wrote, Good turns false on the first malformed or truncated value and stays false
+    class Reader
+    {
+    public:
+        const std::uint8_t *Data = NULL;
+
+        std::size_t Size = 0;
+
+        std::size_t Position = 0;
+
+        bool Good = true;
+
+        Reader(const std::string &bytes) : Data((const std::uint8_t *)bytes.data()), Size(bytes.size())
+        {
+        }
+
+        Reader(const std::uint8_t *data, std::size_t size) : Data(data), Size(size)
+        {
+        }
+
+        bool END()
+        {
+            return !Good || Position >= Size;
+        }
+
+        std::uint8_t BYTE()
+        {
+            if (Position >= Size)
+            {
+                Good = false;
+
+                return 0;
+            }
+
+            return Data[Position++];
+        }
+
+        std::uint64_t UNSIGNED()
+        {
+            std::uint64_t value = 0;
+
+            for (auto shift = 0; shift < 64; shift += 7)
+            {
+                auto byte = BYTE();
+
+                value |= (std::uint64_t)(byte & 0x7F) << shift;
+
+                if (!Good || (byte & 0x80) == 0)
+                {
+                    return value;
+                }
+            }
+
+            Good = false;
+
+            return 0;
+        }
+
+        std::int64_t INT()
+        {
+            auto value = UNSIGNED();
+
+            return (std::int64_t)(value >> 1) ^ -(std::int64_t)(value & 1);
+        }
+
+        std::uint32_t FIXED32()
+        {
+            auto value = std::uint32_t(0);
+
+            for (auto i = 0; i < 4; i++)
+            {
+                value |= (std::uint32_t)BYTE() << (8 * i);
+            }
+
+            return value;
+        }
+
+        // a length that cannot possibly fit in what is left marks the data as malformed
+        std::size_t LENGTH()
+        {
+            auto length = UNSIGNED();
+
+            if (length > Size - Position)
+            {
+                Good = false;
+
+                return 0;
+            }
+
+            return (std::size_t)length;
+        }
+
+        std::string STRING()
+        {
+            auto length = LENGTH();
+
+            auto text = std::string((const char *)Data + Position, length);
+
+            Position += length;
+
+            return text;
+        }
+
+        Item::Base ITEM()
+        {
+            auto type = static_cast<Item::Type>(INT());
+
+            auto variant = static_cast<Item::Variant>(INT());
+
+            auto charge = (int)INT();
+
+            if (!Item::IsValid(type))
+            {
+                Good = false;
+            }
+
+            return Item::Base(type, variant, charge);
+        }
+
+        Item::List ITEMS()
+        {
+            auto items = Item::List();
+
+            auto count = LENGTH();
+
+            for (auto i = 0; i < count && Good; i++)
+            {
+                items.push_back(ITEM());
+            }
+
+            return items;
+        }
+
+        Skill::List SKILLS()
+        {
+            auto skills = Skill::List();
+
+            auto count = LENGTH();
+
+            for (auto i = 0; i < count && Good; i++)
+            {
+                auto skill = static_cast<Skill::Type>(INT());
+
+                if (Skill::IsValid(skill))
+                {
+                    skills.push_back(Skill::ALL[(int)skill]);
+                }
+                else
+                {
+                    Good = false;
+                }
+            }
+
+            return skills;
+        }
+
+        std::vector<int> VALUES()
+        {
+            auto values = std::vector<int>();
+
+            auto count = LENGTH();
+
+            for (auto i = 0; i < count && Good; i++)
+            {
+                values.push_back((int)INT());
+            }
+
+            return values;
+        }
+
+        Character::Base CHARACTER()
+        {
+            auto player = Character::Base();
+
+            player.Name = Character::INTERN(STRING());
+            player.Description = Character::INTERN(STRING());
+
+            STATE(player);
+
+            return player;
+        }
+
+        // everything Writer::FIELDS holds after the name and description
+        void STATE(Character::Base &player)
+        {
+            player.Type = static_cast<Character::Type>(INT());
+            player.Life = (int)INT();
+            player.Money = (int)INT();
+            player.ITEM_LIMIT = (int)INT();
+            player.MAX_LIFE_LIMIT = (int)INT();
+            player.SKILLS_LIMIT = (int)INT();
+            player.LostMoney = (int)INT();
+            player.StoryID = (int)INT();
+            player.Epoch = INT();
+
+            auto ship = static_cast<Ship::Type>(INT());
+
+            auto stars = (int)INT();
+
+            player.Ship = Ship::LOOKUP(ship);
+
+            if (player.Ship.Type != Ship::Type::NONE)
+            {
+                player.Ship.Stars = stars;
+            }
+
+            player.Skills = SKILLS();
+            player.LostSkills = SKILLS();
+            player.TemporarySkills = SKILLS();
+            player.Items = ITEMS();
+            player.LostItems = ITEMS();
+
+            auto codewords = VALUES();
+
+            for (auto i = 0; i < codewords.size(); i++)
+            {
+                if (Codeword::IsValid(static_cast<Codeword::Type>(codewords[i])))
+                {
+                    player.Codewords.push_back(static_cast<Codeword::Type>(codewords[i]));
+                }
+                else
+                {
+                    Good = false;
+                }
+            }
+
+            Character::REHASH(player);
+        }
+    };
+
+} // namespace Binary
+
+#endif
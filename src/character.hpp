@@ -1,13 +1,21 @@
 #ifndef __CHARACTER__HPP__
 #define __CHARACTER__HPP__
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "codewords.hpp"
 #include "items.hpp"
+#include "mutation.hpp"
 #include "skills.hpp"
 #include "ships.hpp"
+#include "zobrist.hpp"
 
 namespace Character
 {
@@ -26,9 +34,9 @@ namespace Character
     class Base
     {
     public:
-        std::string Name = "";
+        const char *Name = "";
 
-        std::string Description = "";
+        const char *Description = "";
 
         Character::Type Type = Character::Type::CUSTOM;
 
@@ -42,17 +50,17 @@ namespace Character
 
         int SKILLS_LIMIT = 4;
 
-        std::vector<Skill::Base> Skills = std::vector<Skill::Base>();
+        Skill::List Skills = Skill::List();
 
-        std::vector<Item::Base> Items = std::vector<Item::Base>();
+        Item::List Items = Item::List();
 
-        std::vector<Codeword::Type> Codewords = std::vector<Codeword::Type>();
+        Codeword::List Codewords = Codeword::List();
 
-        std::vector<Item::Base> LostItems = std::vector<Item::Base>();
+        Item::List LostItems = Item::List();
 
-        std::vector<Skill::Base> LostSkills = std::vector<Skill::Base>();
+        Skill::List LostSkills = Skill::List();
 
-        std::vector<Skill::Base> TemporarySkills = std::vector<Skill::Base>();
+        Skill::List TemporarySkills = Skill::List();
 
         Ship::Base Ship = Ship::NONE;
 
@@ -66,39 +74,52 @@ namespace Character
         long Epoch = 0;
 #endif
 
+        // kept up to date by the Character:: mutators, see Zobrist::STATE
+        std::uint64_t Hash = 0;
+
+        // where the Character:: mutators record what they change, if anywhere
+        Mutation::Tap Mutations = Mutation::Tap();
+
         Base()
         {
+            Hash = Zobrist::STATE(*this);
         }
 
-        Base(const char *name, Character::Type type, const char *description, std::vector<Skill::Base> skills, int money)
+        Base(const char *name, Character::Type type, const char *description, Skill::List skills, int money)
         {
             Name = name;
             Type = type;
             Description = description;
-            Skills = skills;
+            Skills = std::move(skills);
             Money = money;
+
+            Hash = Zobrist::STATE(*this);
         }
 
-        Base(const char *name, Character::Type type, const char *description, std::vector<Skill::Base> skills, std::vector<Item::Base> items, int money)
+        Base(const char *name, Character::Type type, const char *description, Skill::List skills, Item::List items, int money)
         {
             Name = name;
             Type = type;
             Description = description;
-            Skills = skills;
-            Items = items;
+            Skills = std::move(skills);
+            Items = std::move(items);
             Money = money;
+
+            Hash = Zobrist::STATE(*this);
         }
 
-        Base(const char *name, Character::Type type, const char *description, std::vector<Skill::Base> skills, std::vector<Item::Base> items, std::vector<Codeword::Type> codewords, int life, int money)
+        Base(const char *name, Character::Type type, const char *description, Skill::List skills, Item::List items, Codeword::List codewords, int life, int money)
         {
             Name = name;
             Type = type;
             Description = description;
-            Skills = skills;
-            Items = items;
-            Codewords = codewords;
+            Skills = std::move(skills);
+            Items = std::move(items);
+            Codewords = std::move(codewords);
             Life = life;
             Money = money;
+
+            Hash = Zobrist::STATE(*this);
         }
     };
 
@@ -113,6 +134,78 @@ namespace Character
 
     std::vector<Character::Base> Classes = {Character::ADVENTURER, Character::BUCCANEER, Character::CHANGELING, Character::GYPSY, Character::MARINER, Character::MARINER, Character::SWASHBUCKLER, Character::WARLOCK};
 
+    // every class once, for anything that plays or checks each class in turn
+    std::vector<Character::Base> DISTINCT(const std::vector<Character::Base> &classes)
+    {
+        auto distinct = std::vector<Character::Base>();
+
+        for (auto i = 0; i < classes.size(); i++)
+        {
+            auto duplicate = false;
+
+            for (auto j = 0; j < distinct.size(); j++)
+            {
+                duplicate |= distinct[j].Type == classes[i].Type;
+            }
+
+            if (!duplicate)
+            {
+                distinct.push_back(classes[i]);
+            }
+        }
+
+        return distinct;
+    }
+
+    // Classes lists the Mariner twice
+    std::vector<Character::Base> Archetypes = Character::DISTINCT(Character::Classes);
+
+    // keeps names and descriptions read from saved games alive for the lifetime of the program
+    std::set<std::string> Strings = std::set<std::string>();
+
+    // saves are read from several threads at once by SaveCheck
+    std::mutex StringsLock;
+
+    const char *INTERN(std::string text)
+    {
+        auto characters = {&Character::ADVENTURER, &Character::BUCCANEER, &Character::CHANGELING, &Character::GYPSY, &Character::MARINER, &Character::SWASHBUCKLER, &Character::WARLOCK, &Character::CUSTOM};
+
+        for (auto character : characters)
+        {
+            if (text == character->Name)
+            {
+                return character->Name;
+            }
+            else if (text == character->Description)
+            {
+                return character->Description;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(Character::StringsLock);
+
+        return Character::Strings.insert(text).first->c_str();
+    }
+
+    // the strings interned so far, see RELEASE
+    std::set<std::string> INTERNED()
+    {
+        std::lock_guard<std::mutex> lock(Character::StringsLock);
+
+        return Character::Strings;
+    }
+
+    // forgets every string interned since INTERNED, only once no character read in between is left
+    void RELEASE(const std::set<std::string> &kept)
+    {
+        std::lock_guard<std::mutex> lock(Character::StringsLock);
+
+        for (auto it = Character::Strings.begin(); it != Character::Strings.end();)
+        {
+            it = kept.count(*it) > 0 ? std::next(it) : Character::Strings.erase(it);
+        }
+    }
+
     int FIND_ITEM(Character::Base &player, Item::Type item)
     {
         auto found = -1;
@@ -173,7 +266,7 @@ namespace Character
         return found >= items.size();
     }
 
-    int COUNT_ITEMS(Character::Base &player, std::vector<Item::Base> items)
+    int COUNT_ITEMS(Character::Base &player, const Item::List &items)
     {
         auto found = 0;
 
@@ -188,7 +281,7 @@ namespace Character
         return found;
     }
 
-    bool VERIFY_ITEMS_ANY(Character::Base &player, std::vector<Item::Base> items)
+    bool VERIFY_ITEMS_ANY(Character::Base &player, const Item::List &items)
     {
         return Character::COUNT_ITEMS(player, items) > 0;
     }
@@ -405,9 +498,168 @@ namespace Character
         return player.Items.size() <= player.ITEM_LIMIT;
     }
 
-    void GET_ITEMS(Character::Base &player, std::vector<Item::Base> items)
+    // recomputes the hash after fields were set directly, e.g. when loading a game
+    void REHASH(Character::Base &player)
+    {
+        player.Hash = Zobrist::STATE(player);
+    }
+
+    // swaps the key of a field's old value for the new one
+    void REKEY(Character::Base &player, Zobrist::Field field, int from, int to)
+    {
+        player.Hash += Zobrist::KEY(field, to) - Zobrist::KEY(field, from);
+    }
+
+    // carries out a single change, every mutator below comes down to these
+    void EXECUTE(Character::Base &player, const Mutation::Record &record)
+    {
+        switch (record.Type)
+        {
+        case Mutation::Type::LIFE:
+            Character::REKEY(player, Zobrist::Field::LIFE, player.Life, record.After);
+            player.Life = record.After;
+            break;
+        case Mutation::Type::LIFE_LIMIT:
+            Character::REKEY(player, Zobrist::Field::LIFE_LIMIT, player.MAX_LIFE_LIMIT, record.After);
+            player.MAX_LIFE_LIMIT = record.After;
+            break;
+        case Mutation::Type::MONEY:
+            Character::REKEY(player, Zobrist::Field::MONEY, player.Money, record.After);
+            player.Money = record.After;
+            break;
+        case Mutation::Type::LOST_MONEY:
+            player.LostMoney = record.After;
+            break;
+        case Mutation::Type::SKILLS_LIMIT:
+            Character::REKEY(player, Zobrist::Field::SKILLS_LIMIT, player.SKILLS_LIMIT, record.After);
+            player.SKILLS_LIMIT = record.After;
+            break;
+        case Mutation::Type::SHIP:
+        {
+            // the rating is a change of its own
+            auto stars = player.Ship.Stars;
+            Character::REKEY(player, Zobrist::Field::SHIP, (int)player.Ship.Type, record.After);
+            player.Ship = Ship::LOOKUP(static_cast<Ship::Type>(record.After));
+            player.Ship.Stars = stars;
+            break;
+        }
+        case Mutation::Type::STARS:
+            Character::REKEY(player, Zobrist::Field::STARS, player.Ship.Stars, record.After);
+            player.Ship.Stars = record.After;
+            break;
+        case Mutation::Type::CHARGE:
+            player.Hash -= Zobrist::ITEM(player.Items[record.Index]);
+            player.Items[record.Index].Charge = record.After;
+            player.Hash += Zobrist::ITEM(player.Items[record.Index]);
+            break;
+        case Mutation::Type::ADD_ITEM:
+            player.Items.insert(player.Items.begin() + record.Index, record.Item);
+            player.Hash += Zobrist::ITEM(record.Item);
+            break;
+        case Mutation::Type::REMOVE_ITEM:
+            player.Hash -= Zobrist::ITEM(player.Items[record.Index]);
+            player.Items.erase(player.Items.begin() + record.Index);
+            break;
+        case Mutation::Type::ADD_LOST_ITEM:
+            player.LostItems.insert(player.LostItems.begin() + record.Index, record.Item);
+            break;
+        case Mutation::Type::REMOVE_LOST_ITEM:
+            player.LostItems.erase(player.LostItems.begin() + record.Index);
+            break;
+        case Mutation::Type::ADD_SKILL:
+            player.Skills.insert(player.Skills.begin() + record.Index, Skill::ALL[record.After]);
+            player.Hash += Zobrist::KEY(Zobrist::Field::SKILL, record.After);
+            break;
+        case Mutation::Type::REMOVE_SKILL:
+            player.Hash -= Zobrist::KEY(Zobrist::Field::SKILL, (int)player.Skills[record.Index].Type);
+            player.Skills.erase(player.Skills.begin() + record.Index);
+            break;
+        case Mutation::Type::ADD_LOST_SKILL:
+            player.LostSkills.insert(player.LostSkills.begin() + record.Index, Skill::ALL[record.After]);
+            break;
+        case Mutation::Type::REMOVE_LOST_SKILL:
+            player.LostSkills.erase(player.LostSkills.begin() + record.Index);
+            break;
+        case Mutation::Type::ADD_TEMPORARY_SKILL:
+            player.TemporarySkills.insert(player.TemporarySkills.begin() + record.Index, Skill::ALL[record.After]);
+            player.Hash += Zobrist::KEY(Zobrist::Field::TEMPORARY_SKILL, record.After);
+            break;
+        case Mutation::Type::REMOVE_TEMPORARY_SKILL:
+            player.Hash -= Zobrist::KEY(Zobrist::Field::TEMPORARY_SKILL, (int)player.TemporarySkills[record.Index].Type);
+            player.TemporarySkills.erase(player.TemporarySkills.begin() + record.Index);
+            break;
+        case Mutation::Type::ADD_CODEWORD:
+            player.Codewords.insert(player.Codewords.begin() + record.Index, static_cast<Codeword::Type>(record.After));
+            player.Hash += Zobrist::KEY(Zobrist::Field::CODEWORD, record.After);
+            break;
+        case Mutation::Type::REMOVE_CODEWORD:
+            player.Hash -= Zobrist::KEY(Zobrist::Field::CODEWORD, (int)player.Codewords[record.Index]);
+            player.Codewords.erase(player.Codewords.begin() + record.Index);
+            break;
+        }
+    }
+
+    // carries out the change and records it in the attached log
+    void MUTATE(Character::Base &player, const Mutation::Record &record)
+    {
+        Character::EXECUTE(player, record);
+
+        if (player.Mutations.Log)
+        {
+            player.Mutations.Log->RECORD(record);
+        }
+    }
+
+    // plays logged records forward, e.g. onto a copy of the character the log started from
+    void APPLY(Character::Base &player, const Mutation::Log &log, std::size_t from, std::size_t to)
+    {
+        for (auto i = from; i < to && i < log.Records.size(); i++)
+        {
+            Character::EXECUTE(player, log.Records[i]);
+        }
+    }
+
+    // undoes everything the attached log holds from mark on and forgets it
+    void REVERT(Character::Base &player, std::size_t mark)
+    {
+        auto log = player.Mutations.Log;
+
+        if (log)
+        {
+            for (auto i = log->Records.size(); i > mark; i--)
+            {
+                Character::EXECUTE(player, Mutation::INVERSE(log->Records[i - 1]));
+            }
+
+            log->TRUNCATE(mark);
+        }
+    }
+
+    // undoes the sections committed that many steps back and whatever followed them
+    void UNDO(Character::Base &player, int sections)
+    {
+        if (player.Mutations.Log)
+        {
+            Character::REVERT(player, player.Mutations.Log->MARK(sections));
+        }
+    }
+
+    void ADD_ITEM(Character::Base &player, const Item::Base &item)
+    {
+        Character::MUTATE(player, Mutation::Record(Mutation::Type::ADD_ITEM, player.Items.size(), item));
+    }
+
+    void REMOVE_ITEM(Character::Base &player, int index)
+    {
+        Character::MUTATE(player, Mutation::Record(Mutation::Type::REMOVE_ITEM, index, player.Items[index]));
+    }
+
+    void GET_ITEMS(Character::Base &player, const Item::List &items)
     {
-        player.Items.insert(player.Items.end(), items.begin(), items.end());
+        for (auto i = 0; i < items.size(); i++)
+        {
+            Character::ADD_ITEM(player, items[i]);
+        }
     }
 
     void GET_CODEWORDS(Character::Base &player, std::vector<Codeword::Type> codewords)
@@ -416,7 +668,7 @@ namespace Character
         {
             if (!Character::VERIFY_CODEWORD(player, codewords[i]))
             {
-                player.Codewords.push_back(codewords[i]);
+                Character::MUTATE(player, Mutation::Record(Mutation::Type::ADD_CODEWORD, player.Codewords.size(), 0, (int)codewords[i]));
             }
         }
     }
@@ -429,18 +681,18 @@ namespace Character
 
             if (result >= 0)
             {
-                player.Codewords.erase(player.Codewords.begin() + result);
+                Character::MUTATE(player, Mutation::Record(Mutation::Type::REMOVE_CODEWORD, result, 0, (int)codeword));
             }
         }
     }
 
-    void GET_UNIQUE_ITEMS(Character::Base &player, std::vector<Item::Base> items)
+    void GET_UNIQUE_ITEMS(Character::Base &player, const Item::List &items)
     {
         for (auto i = 0; i < items.size(); i++)
         {
             if (!Character::VERIFY_ITEMS(player, {items[i].Type}))
             {
-                player.Items.push_back(items[i]);
+                Character::ADD_ITEM(player, items[i]);
             }
         }
     }
@@ -455,12 +707,50 @@ namespace Character
 
                 if (result >= 0)
                 {
-                    player.Items.erase(player.Items.begin() + result);
+                    Character::REMOVE_ITEM(player, result);
                 }
             }
         }
     }
 
+    // removes the items at the selected positions in the inventory
+    void DROP_ITEMS(Character::Base &player, std::vector<int> selection)
+    {
+        std::sort(selection.begin(), selection.end());
+
+        for (auto i = (int)selection.size() - 1; i >= 0; i--)
+        {
+            if (selection[i] >= 0 && selection[i] < player.Items.size() && (i == selection.size() - 1 || selection[i] != selection[i + 1]))
+            {
+                Character::REMOVE_ITEM(player, selection[i]);
+            }
+        }
+    }
+
+    void CLEAR_ITEMS(Character::Base &player)
+    {
+        for (auto i = (int)player.Items.size() - 1; i >= 0; i--)
+        {
+            Character::REMOVE_ITEM(player, i);
+        }
+    }
+
+    void SET_CHARGE(Character::Base &player, int index, int charge)
+    {
+        if (index >= 0 && index < player.Items.size())
+        {
+            Character::MUTATE(player, Mutation::Record(Mutation::Type::CHARGE, index, player.Items[index].Charge, charge));
+        }
+    }
+
+    void GET_SKILLS(Character::Base &player, const Skill::List &skills)
+    {
+        for (auto i = 0; i < skills.size(); i++)
+        {
+            Character::MUTATE(player, Mutation::Record(Mutation::Type::ADD_SKILL, player.Skills.size(), 0, (int)skills[i].Type));
+        }
+    }
+
     void LOSE_SKILLS(Character::Base &player, std::vector<Skill::Type> skills)
     {
         if (player.Skills.size() > 0 && skills.size() > 0)
@@ -471,76 +761,135 @@ namespace Character
 
                 if (result >= 0)
                 {
-                    player.LostSkills.push_back(player.Skills[result]);
+                    auto skill = (int)player.Skills[result].Type;
+
+                    Character::MUTATE(player, Mutation::Record(Mutation::Type::ADD_LOST_SKILL, player.LostSkills.size(), 0, skill));
 
-                    player.Skills.erase(player.Skills.begin() + result);
+                    Character::MUTATE(player, Mutation::Record(Mutation::Type::REMOVE_SKILL, result, 0, skill));
                 }
             }
         }
     }
 
+    void GET_TEMPORARY_SKILLS(Character::Base &player, const Skill::List &skills)
+    {
+        for (auto i = 0; i < skills.size(); i++)
+        {
+            Character::MUTATE(player, Mutation::Record(Mutation::Type::ADD_TEMPORARY_SKILL, player.TemporarySkills.size(), 0, (int)skills[i].Type));
+        }
+    }
+
+    void CLEAR_TEMPORARY_SKILLS(Character::Base &player)
+    {
+        for (auto i = (int)player.TemporarySkills.size() - 1; i >= 0; i--)
+        {
+            Character::MUTATE(player, Mutation::Record(Mutation::Type::REMOVE_TEMPORARY_SKILL, i, 0, (int)player.TemporarySkills[i].Type));
+        }
+    }
+
+    void SET_SKILLS_LIMIT(Character::Base &player, int limit)
+    {
+        Character::MUTATE(player, Mutation::Record(Mutation::Type::SKILLS_LIMIT, player.SKILLS_LIMIT, limit));
+    }
+
+    void SET_LIFE(Character::Base &player, int life)
+    {
+        Character::MUTATE(player, Mutation::Record(Mutation::Type::LIFE, player.Life, life));
+    }
+
+    void SET_LIFE_LIMIT(Character::Base &player, int limit)
+    {
+        Character::MUTATE(player, Mutation::Record(Mutation::Type::LIFE_LIMIT, player.MAX_LIFE_LIMIT, limit));
+    }
+
     void GAIN_LIFE(Character::Base &player, int life)
     {
-        player.Life += life;
+        life += player.Life;
 
-        if (player.Life < 0)
+        if (life < 0)
         {
-            player.Life = 0;
+            life = 0;
         }
-        else if (player.Life > player.MAX_LIFE_LIMIT)
+        else if (life > player.MAX_LIFE_LIMIT)
         {
-            player.Life = player.MAX_LIFE_LIMIT;
+            life = player.MAX_LIFE_LIMIT;
         }
+
+        Character::SET_LIFE(player, life);
     }
 
     void GAIN_MONEY(Character::Base &player, int money)
     {
-        player.Money += money;
+        money += player.Money;
 
-        if (player.Money < 0)
+        if (money < 0)
         {
-            player.Money = 0;
+            money = 0;
         }
+
+        Character::MUTATE(player, Mutation::Record(Mutation::Type::MONEY, player.Money, money));
+    }
+
+    void LOSE_MONEY(Character::Base &player)
+    {
+        Character::MUTATE(player, Mutation::Record(Mutation::Type::LOST_MONEY, player.LostMoney, player.LostMoney + player.Money));
+
+        Character::GAIN_MONEY(player, -player.Money);
     }
 
     void LOSE_POSSESSIONS(Character::Base &player)
     {
-        player.LostItems = player.Items;
+        for (auto i = (int)player.LostItems.size() - 1; i >= 0; i--)
+        {
+            Character::MUTATE(player, Mutation::Record(Mutation::Type::REMOVE_LOST_ITEM, i, player.LostItems[i]));
+        }
 
-        player.Items.clear();
+        for (auto i = 0; i < player.Items.size(); i++)
+        {
+            Character::MUTATE(player, Mutation::Record(Mutation::Type::ADD_LOST_ITEM, i, player.Items[i]));
+        }
+
+        Character::CLEAR_ITEMS(player);
     }
 
     void LOSE_ALL(Character::Base &player)
     {
-        player.LostMoney = player.LostMoney;
-        player.Money = 0;
+        Character::LOSE_MONEY(player);
 
         Character::LOSE_POSSESSIONS(player);
     }
 
     void TAKE_SHIP(Character::Base &player, Ship::Base ship)
     {
-        player.Ship = ship;
+        Character::MUTATE(player, Mutation::Record(Mutation::Type::SHIP, (int)player.Ship.Type, (int)ship.Type));
+
+        Character::MUTATE(player, Mutation::Record(Mutation::Type::STARS, player.Ship.Stars, ship.Stars));
     }
 
     void LOSE_SHIP(Character::Base &player)
     {
-        player.Ship = Ship::NONE;
+        Character::TAKE_SHIP(player, Ship::NONE);
+    }
+
+    void SET_SHIP_STARS(Character::Base &player, int stars)
+    {
+        Character::MUTATE(player, Mutation::Record(Mutation::Type::STARS, player.Ship.Stars, stars));
     }
 
     void DAMAGE_SHIP(Character::Base &player, int damage)
     {
         if (player.Ship.Type != Ship::Type::NONE)
         {
-            player.Ship.Stars -= damage;
-
-            if (player.Ship.Stars < 0)
-            {
-                player.Ship.Stars = 0;
-            }
+            Character::SET_SHIP_STARS(player, std::max(0, player.Ship.Stars - damage));
         }
     }
 
+    // restores the ship to its full rating
+    void REPAIR_SHIP(Character::Base &player)
+    {
+        Character::SET_SHIP_STARS(player, player.Ship.Type != Ship::Type::NONE ? Ship::STARS(player.Ship.Type) : 0);
+    }
+
     bool CHECK_SHIP(Character::Base &player)
     {
         auto condition = false;
@@ -0,0 +1,591 @@
+#ifndef __CHOICES__HPP__
+#define __CHOICES__HPP__
+
+#include <vector>
+
+#include "character.hpp"
+#include "codewords.hpp"
+#include "items.hpp"
+#include "skills.hpp"
+#include "smallvector.hpp"
+
+namespace Choice
+{
+    enum class Type
+    {
+        NORMAL = 0, // No requirements
+        ITEMS,
+        GET_ITEMS,
+        SKILL,
+        CODEWORD,
+        MONEY,
+        LIFE,
+        ANY_ITEM,
+        ANY_SKILL,
+        SKILL_ITEM,
+        SKILL_ANY,
+        SKILL_ALL,
+        FIRE_WEAPON,
+        LOSE_ITEMS,
+        LOSE_MONEY,
+        LOSE_ALL,
+        LOSE_SKILLS,
+        GET_CODEWORD,
+        LOSE_CODEWORD,
+        GAIN_MONEY,
+        GIVE,
+        BRIBE,
+        TAKE,
+        PAY_WITH,
+        SELL,
+        First = NORMAL,
+        Last = SELL
+    };
+
+    class Base
+    {
+    public:
+        const char *Text = NULL;
+
+        Choice::Type Type = Choice::Type::NORMAL;
+
+        Skill::Type Skill = Skill::Type::NONE;
+
+        Item::List Items = Item::List();
+
+        Codeword::Type Codeword = Codeword::Type::NONE;
+
+        int Value = 0;
+
+        int Destination = -1;
+
+        Base(const char *text, int destination)
+        {
+            Text = text;
+            Destination = destination;
+        }
+
+        Base(const char *text, int destination, Skill::Type skill, Item::List items)
+        {
+            Text = text;
+            Destination = destination;
+            Type = Choice::Type::SKILL_ITEM;
+            Items = items;
+            Skill = skill;
+        }
+
+        Base(const char *text, int destination, Item::List items)
+        {
+            Text = text;
+            Destination = destination;
+            Type = Choice::Type::ITEMS;
+            Items = items;
+        }
+
+        Base(const char *text, int destination, Skill::Type skill)
+        {
+            Text = text;
+            Destination = destination;
+            Type = Choice::Type::SKILL;
+            Skill = skill;
+        }
+
+        Base(const char *text, int destination, Codeword::Type codeword)
+        {
+            Text = text;
+            Destination = destination;
+            Type = Choice::Type::CODEWORD;
+            Codeword = codeword;
+        }
+
+        Base(const char *text, int destination, Choice::Type type, int value)
+        {
+            Text = text;
+            Destination = destination;
+            Type = type;
+            Value = value;
+        }
+
+        Base(const char *text, int destination, Choice::Type type)
+        {
+            Text = text;
+            Destination = destination;
+            Type = type;
+        }
+
+        Base(const char *text, int destination, Choice::Type type, Item::List items)
+        {
+            Text = text;
+            Destination = destination;
+            Type = type;
+            Items = items;
+        }
+
+        Base(const char *text, int destination, Choice::Type type, Skill::Type skill, Item::List items)
+        {
+            Text = text;
+            Destination = destination;
+            Type = type;
+            Skill = skill;
+            Items = items;
+        }
+
+        Base(const char *text, int destination, Choice::Type type, Item::List items, int value)
+        {
+            Text = text;
+            Destination = destination;
+            Type = type;
+            Items = items;
+            Value = value;
+        }
+
+        Base(const char *text, int destination, Choice::Type type, Codeword::Type codeword)
+        {
+            Text = text;
+            Destination = destination;
+            Type = type;
+            Codeword = codeword;
+        }
+    };
+
+    // what the player still has to decide after a choice's effect has been applied
+    enum class Interaction
+    {
+        NONE = 0,
+        TAKE,
+        GIVE,
+        BRIBE,
+        LOSE_SKILLS
+    };
+
+    typedef bool (*Predicate)(Character::Base &player, Choice::Base &choice);
+
+    typedef const char *(*Reason)(Character::Base &player, Choice::Base &choice);
+
+    typedef Choice::Interaction (*Effect)(Character::Base &player, Choice::Base &choice);
+
+    class Rule
+    {
+    public:
+        Choice::Type Type = Choice::Type::NORMAL;
+
+        // can the choice be taken in the current state
+        Choice::Predicate Available = NULL;
+
+        // why not
+        Choice::Reason Explain = NULL;
+
+        // changes to the character once the choice is taken
+        Choice::Effect Apply = NULL;
+    };
+
+    // availability of every choice in a section, in section order
+    typedef SmallVector<bool, 16> Availability;
+
+    std::vector<Item::Type> TYPES(Choice::Base &choice)
+    {
+        auto items = std::vector<Item::Type>();
+
+        for (auto i = 0; i < choice.Items.size(); i++)
+        {
+            items.push_back(choice.Items[i].Type);
+        }
+
+        return items;
+    }
+
+    // Predicates
+
+    bool ALWAYS([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return true;
+    }
+
+    bool NEVER([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return false;
+    }
+
+    bool HAS_ITEMS(Character::Base &player, Choice::Base &choice)
+    {
+        return Character::VERIFY_ITEMS(player, Choice::TYPES(choice));
+    }
+
+    bool HAS_ANY_ITEM(Character::Base &player, Choice::Base &choice)
+    {
+        return Character::VERIFY_ITEMS_ANY(player, choice.Items);
+    }
+
+    bool HAS_CODEWORD(Character::Base &player, Choice::Base &choice)
+    {
+        return Character::VERIFY_CODEWORD(player, choice.Codeword);
+    }
+
+    bool HAS_MONEY(Character::Base &player, Choice::Base &choice)
+    {
+        return player.Money >= choice.Value;
+    }
+
+    bool HAS_SKILL(Character::Base &player, Choice::Base &choice)
+    {
+        return Character::VERIFY_SKILL(player, choice.Skill);
+    }
+
+    bool HAS_SKILL_ANY(Character::Base &player, Choice::Base &choice)
+    {
+        return Character::VERIFY_SKILL_ANY(player, choice.Skill, Choice::TYPES(choice));
+    }
+
+    bool HAS_SKILL_ALL(Character::Base &player, Choice::Base &choice)
+    {
+        return Character::VERIFY_SKILL_ALL(player, choice.Skill, Choice::TYPES(choice));
+    }
+
+    bool HAS_SKILL_ITEMS(Character::Base &player, Choice::Base &choice)
+    {
+        return Character::HAS_SKILL(player, choice.Skill) && Character::VERIFY_ITEMS(player, Choice::TYPES(choice));
+    }
+
+    bool CAN_PAY(Character::Base &player, Choice::Base &choice)
+    {
+        return choice.Items.size() > 0 && Item::COUNT_TYPES(player.Items, choice.Items[0].Type) >= choice.Value;
+    }
+
+    bool CAN_SELL(Character::Base &player, Choice::Base &choice)
+    {
+        return choice.Items.size() > 0 && Item::COUNT_TYPES(player.Items, choice.Items[0].Type) > 0;
+    }
+
+    bool CAN_GIVE(Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return player.Items.size() > 0;
+    }
+
+    bool CAN_BRIBE(Character::Base &player, Choice::Base &choice)
+    {
+        auto count = 0;
+
+        for (auto i = 0; i < choice.Items.size(); i++)
+        {
+            count += Item::COUNT_TYPES(player.Items, choice.Items[i].Type);
+        }
+
+        return count >= choice.Value;
+    }
+
+    // Reasons
+
+    const char *NO_REASON([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return NULL;
+    }
+
+    const char *NO_ITEMS(Character::Base &player, Choice::Base &choice)
+    {
+        auto weapons = 0;
+
+        for (auto i = 0; i < choice.Items.size(); i++)
+        {
+            // items carried but not loaded
+            if (Item::VERIFY(player.Items, choice.Items[i]))
+            {
+                weapons++;
+            }
+        }
+
+        if (weapons > 1)
+        {
+            return "The weapons you are carrying are not loaded!";
+        }
+        else if (weapons > 0)
+        {
+            return "The weapon you are carrying is not loaded!";
+        }
+        else if (choice.Items.size() > 1)
+        {
+            return "You do not have the required items!";
+        }
+        else
+        {
+            return "You do not have the required item!";
+        }
+    }
+
+    const char *NO_ANY_ITEM([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return "You do not have any of the required items that can be used.";
+    }
+
+    const char *NO_CODEWORD([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return "You do not have the required codeword!";
+    }
+
+    const char *NO_MONEY([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return "You do not have enough money!";
+    }
+
+    const char *NO_SKILL(Character::Base &player, Choice::Base &choice)
+    {
+        if (Character::HAS_SKILL(player, choice.Skill))
+        {
+            auto result = Character::FIND_SKILL(player, choice.Skill);
+
+            if (Item::FIND_TYPE(player.Items, player.Skills[result].Requirement) >= 0)
+            {
+                return "The item you are carrying is not loaded!";
+            }
+            else
+            {
+                return "You do not have the required item to use with this skill!";
+            }
+        }
+        else
+        {
+            return "You do not possess the required skill!";
+        }
+    }
+
+    const char *NO_SKILL_ANY(Character::Base &player, Choice::Base &choice)
+    {
+        if (Character::HAS_SKILL(player, choice.Skill))
+        {
+            return "You do not have any of the required item to use with this skill!";
+        }
+        else
+        {
+            return "You do not possess the required skill!";
+        }
+    }
+
+    const char *NO_SKILL_ITEMS(Character::Base &player, Choice::Base &choice)
+    {
+        if (Character::HAS_SKILL(player, choice.Skill))
+        {
+            return "You do not have the required item!";
+        }
+        else
+        {
+            return "You do not possess the required skill!";
+        }
+    }
+
+    const char *NO_PAYMENT([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return "You do not have the enough!";
+    }
+
+    const char *NO_SALE([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return "You do not have that!";
+    }
+
+    const char *NO_LOSS([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return "You do not have the required item!";
+    }
+
+    const char *NO_GIFT([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return "You do not have anything to give!";
+    }
+
+    const char *NO_BRIBE([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return "You do not have enough of the required items!";
+    }
+
+    const char *UNSUPPORTED([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return "This choice is not available.";
+    }
+
+    // Effects
+
+    Choice::Interaction APPLY_NONE([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return Choice::Interaction::NONE;
+    }
+
+    Choice::Interaction APPLY_GET_ITEMS(Character::Base &player, Choice::Base &choice)
+    {
+        Character::GET_ITEMS(player, choice.Items);
+
+        return Choice::Interaction::NONE;
+    }
+
+    Choice::Interaction APPLY_TAKE(Character::Base &player, Choice::Base &choice)
+    {
+        // items already carried are put back into the pile to choose from
+        Character::LOSE_ITEMS(player, Choice::TYPES(choice));
+
+        return Choice::Interaction::TAKE;
+    }
+
+    Choice::Interaction APPLY_PAY_WITH(Character::Base &player, Choice::Base &choice)
+    {
+        for (auto i = 0; i < choice.Value; i++)
+        {
+            Character::LOSE_ITEMS(player, {choice.Items[0].Type});
+        }
+
+        return Choice::Interaction::NONE;
+    }
+
+    Choice::Interaction APPLY_SELL(Character::Base &player, Choice::Base &choice)
+    {
+        Character::LOSE_ITEMS(player, {choice.Items[0].Type});
+
+        Character::GAIN_MONEY(player, choice.Value);
+
+        return Choice::Interaction::NONE;
+    }
+
+    Choice::Interaction APPLY_LOSE_ITEMS(Character::Base &player, Choice::Base &choice)
+    {
+        Character::LOSE_ITEMS(player, Choice::TYPES(choice));
+
+        return Choice::Interaction::NONE;
+    }
+
+    Choice::Interaction APPLY_GIVE(Character::Base &player, Choice::Base &choice)
+    {
+        if (player.Items.size() >= choice.Value)
+        {
+            return Choice::Interaction::GIVE;
+        }
+        else
+        {
+            Character::LOSE_POSSESSIONS(player);
+
+            return Choice::Interaction::NONE;
+        }
+    }
+
+    Choice::Interaction APPLY_BRIBE([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return Choice::Interaction::BRIBE;
+    }
+
+    Choice::Interaction APPLY_GET_CODEWORD(Character::Base &player, Choice::Base &choice)
+    {
+        Character::GET_CODEWORDS(player, {choice.Codeword});
+
+        return Choice::Interaction::NONE;
+    }
+
+    Choice::Interaction APPLY_LOSE_CODEWORD(Character::Base &player, Choice::Base &choice)
+    {
+        Character::REMOVE_CODEWORD(player, choice.Codeword);
+
+        return Choice::Interaction::NONE;
+    }
+
+    Choice::Interaction APPLY_LOSE_ALL(Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        Character::LOSE_ALL(player);
+
+        return Choice::Interaction::NONE;
+    }
+
+    Choice::Interaction APPLY_LOSE_MONEY(Character::Base &player, Choice::Base &choice)
+    {
+        Character::GAIN_MONEY(player, -choice.Value);
+
+        return Choice::Interaction::NONE;
+    }
+
+    Choice::Interaction APPLY_GAIN_MONEY(Character::Base &player, Choice::Base &choice)
+    {
+        Character::GAIN_MONEY(player, choice.Value);
+
+        return Choice::Interaction::NONE;
+    }
+
+    Choice::Interaction APPLY_LIFE(Character::Base &player, Choice::Base &choice)
+    {
+        Character::GAIN_LIFE(player, choice.Value);
+
+        return Choice::Interaction::NONE;
+    }
+
+    Choice::Interaction APPLY_LOSE_SKILLS([[maybe_unused]] Character::Base &player, [[maybe_unused]] Choice::Base &choice)
+    {
+        return Choice::Interaction::LOSE_SKILLS;
+    }
+
+    // dispatch table, indexed by Choice::Type
+    constexpr Choice::Rule Rules[] = {
+        {Choice::Type::NORMAL, Choice::ALWAYS, Choice::NO_REASON, Choice::APPLY_NONE},
+        {Choice::Type::ITEMS, Choice::HAS_ITEMS, Choice::NO_ITEMS, Choice::APPLY_NONE},
+        {Choice::Type::GET_ITEMS, Choice::ALWAYS, Choice::NO_REASON, Choice::APPLY_GET_ITEMS},
+        {Choice::Type::SKILL, Choice::HAS_SKILL, Choice::NO_SKILL, Choice::APPLY_NONE},
+        {Choice::Type::CODEWORD, Choice::HAS_CODEWORD, Choice::NO_CODEWORD, Choice::APPLY_NONE},
+        {Choice::Type::MONEY, Choice::HAS_MONEY, Choice::NO_MONEY, Choice::APPLY_NONE},
+        {Choice::Type::LIFE, Choice::ALWAYS, Choice::NO_REASON, Choice::APPLY_LIFE},
+        {Choice::Type::ANY_ITEM, Choice::HAS_ANY_ITEM, Choice::NO_ANY_ITEM, Choice::APPLY_NONE},
+        {Choice::Type::ANY_SKILL, Choice::NEVER, Choice::UNSUPPORTED, Choice::APPLY_NONE},
+        {Choice::Type::SKILL_ITEM, Choice::HAS_SKILL_ITEMS, Choice::NO_SKILL_ITEMS, Choice::APPLY_NONE},
+        {Choice::Type::SKILL_ANY, Choice::HAS_SKILL_ANY, Choice::NO_SKILL_ANY, Choice::APPLY_NONE},
+        {Choice::Type::SKILL_ALL, Choice::HAS_SKILL_ALL, Choice::NO_SKILL_ITEMS, Choice::APPLY_NONE},
+        {Choice::Type::FIRE_WEAPON, Choice::NEVER, Choice::UNSUPPORTED, Choice::APPLY_NONE},
+        {Choice::Type::LOSE_ITEMS, Choice::HAS_ITEMS, Choice::NO_LOSS, Choice::APPLY_LOSE_ITEMS},
+        {Choice::Type::LOSE_MONEY, Choice::HAS_MONEY, Choice::NO_MONEY, Choice::APPLY_LOSE_MONEY},
+        {Choice::Type::LOSE_ALL, Choice::ALWAYS, Choice::NO_REASON, Choice::APPLY_LOSE_ALL},
+        {Choice::Type::LOSE_SKILLS, Choice::ALWAYS, Choice::NO_REASON, Choice::APPLY_LOSE_SKILLS},
+        {Choice::Type::GET_CODEWORD, Choice::ALWAYS, Choice::NO_REASON, Choice::APPLY_GET_CODEWORD},
+        {Choice::Type::LOSE_CODEWORD, Choice::ALWAYS, Choice::NO_REASON, Choice::APPLY_LOSE_CODEWORD},
+        {Choice::Type::GAIN_MONEY, Choice::ALWAYS, Choice::NO_REASON, Choice::APPLY_GAIN_MONEY},
+        {Choice::Type::GIVE, Choice::CAN_GIVE, Choice::NO_GIFT, Choice::APPLY_GIVE},
+        {Choice::Type::BRIBE, Choice::CAN_BRIBE, Choice::NO_BRIBE, Choice::APPLY_BRIBE},
+        {Choice::Type::TAKE, Choice::ALWAYS, Choice::NO_REASON, Choice::APPLY_TAKE},
+        {Choice::Type::PAY_WITH, Choice::CAN_PAY, Choice::NO_PAYMENT, Choice::APPLY_PAY_WITH},
+        {Choice::Type::SELL, Choice::CAN_SELL, Choice::NO_SALE, Choice::APPLY_SELL}};
+
+    constexpr bool VERIFY_RULES()
+    {
+        auto count = sizeof(Choice::Rules) / sizeof(Choice::Rule);
+
+        auto verified = count == (int)Choice::Type::Last + 1;
+
+        for (auto i = 0; verified && i < count; i++)
+        {
+            verified = Choice::Rules[i].Type == static_cast<Choice::Type>(i) && Choice::Rules[i].Available != NULL && Choice::Rules[i].Explain != NULL && Choice::Rules[i].Apply != NULL;
+        }
+
+        return verified;
+    }
+
+    static_assert(Choice::VERIFY_RULES(), "every choice type needs its own rule in Choice::Rules, in enum order");
+
+    bool AVAILABLE(Character::Base &player, Choice::Base &choice)
+    {
+        return Choice::Rules[(int)choice.Type].Available(player, choice);
+    }
+
+    const char *REASON(Character::Base &player, Choice::Base &choice)
+    {
+        return Choice::Rules[(int)choice.Type].Explain(player, choice);
+    }
+
+    Choice::Interaction APPLY(Character::Base &player, Choice::Base &choice)
+    {
+        return Choice::Rules[(int)choice.Type].Apply(player, choice);
+    }
+
+    // evaluate all choices of a section against the current state of the character
+    Choice::Availability EVALUATE(Character::Base &player, std::vector<Choice::Base> &choices)
+    {
+        auto available = Choice::Availability();
+
+        for (auto i = 0; i < choices.size(); i++)
+        {
+            available.push_back(Choice::AVAILABLE(player, choices[i]));
+        }
+
+        return available;
+    }
+} // namespace Choice
+
+#endif
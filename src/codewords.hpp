@@ -1,7 +1,9 @@
 #ifndef __CODEWORDS__HPP__
 #define __CODEWORDS__HPP__
 
-#include <map>
+#include <vector>
+
+#include "smallvector.hpp"
 
 namespace Codeword
 {
@@ -22,43 +24,72 @@ namespace Codeword
         RAVEN,
         SCRIP,
         FLOAT,
-        COCONUTS
+        COCONUTS,
+        First = AUGUST,
+        Last = COCONUTS
     };
 
-    std::map<Codeword::Type, const char *> Descriptions = {
-        {Codeword::Type::AUGUST, "August"},
-        {Codeword::Type::CHANCERY, "Chancery"},
-        {Codeword::Type::DETRUDE, "Detrude"},
-        {Codeword::Type::FETISH, "Fetish"},
-        {Codeword::Type::HORAL, "Horal"},
-        {Codeword::Type::ICARUS, "Icarus"},
-        {Codeword::Type::MALEFIC, "Malefic"},
-        {Codeword::Type::MAMMON, "Mammon"},
-        {Codeword::Type::MARATHON, "Marathon"},
-        {Codeword::Type::PECCANT, "Peccant"},
-        {Codeword::Type::PROSPERO, "Prospero"},
-        {Codeword::Type::RAVEN, "Raven"},
-        {Codeword::Type::SCRIP, "Scrip"},
-        {Codeword::Type::FLOAT, "Float"},
-        {Codeword::Type::COCONUTS, "Coconuts"}};
-
-    std::vector<Codeword::Type> Invisible = {Codeword::Type::FLOAT, Codeword::Type::COCONUTS};
-
-    bool IsInvisible(Codeword::Type codeword)
+    // inline capacity covers every codeword in the book
+    typedef SmallVector<Codeword::Type, 16> List;
+
+    class Entry
     {
-        auto invisible = false;
+    public:
+        Codeword::Type Type = Codeword::Type::NONE;
 
-        for (auto i = 0; i < Codeword::Invisible.size(); i++)
-        {
-            if (Codeword::Invisible[i] == codeword)
-            {
-                invisible = true;
+        const char *Description = NULL;
+
+        // hidden codewords track story state and are not shown on the adventure sheet
+        bool Invisible = false;
+    };
 
-                break;
-            }
+    // metadata table, indexed by Codeword::Type
+    constexpr Codeword::Entry Catalogue[] = {
+        {Codeword::Type::AUGUST, "August", false},
+        {Codeword::Type::CHANCERY, "Chancery", false},
+        {Codeword::Type::DETRUDE, "Detrude", false},
+        {Codeword::Type::FETISH, "Fetish", false},
+        {Codeword::Type::HORAL, "Horal", false},
+        {Codeword::Type::ICARUS, "Icarus", false},
+        {Codeword::Type::MALEFIC, "Malefic", false},
+        {Codeword::Type::MAMMON, "Mammon", false},
+        {Codeword::Type::MARATHON, "Marathon", false},
+        {Codeword::Type::PECCANT, "Peccant", false},
+        {Codeword::Type::PROSPERO, "Prospero", false},
+        {Codeword::Type::RAVEN, "Raven", false},
+        {Codeword::Type::SCRIP, "Scrip", false},
+        {Codeword::Type::FLOAT, "Float", true},
+        {Codeword::Type::COCONUTS, "Coconuts", true}};
+
+    constexpr bool VERIFY_CATALOGUE()
+    {
+        auto count = sizeof(Codeword::Catalogue) / sizeof(Codeword::Entry);
+
+        auto verified = count == (int)Codeword::Type::Last + 1;
+
+        for (auto i = 0; verified && i < count; i++)
+        {
+            verified = Codeword::Catalogue[i].Type == static_cast<Codeword::Type>(i) && Codeword::Catalogue[i].Description != NULL;
         }
 
-        return invisible;
+        return verified;
+    }
+
+    static_assert(Codeword::VERIFY_CATALOGUE(), "every codeword needs its own entry in Codeword::Catalogue, in enum order");
+
+    constexpr bool IsValid(Codeword::Type codeword)
+    {
+        return codeword >= Codeword::Type::First && codeword <= Codeword::Type::Last;
+    }
+
+    constexpr const char *Description(Codeword::Type codeword)
+    {
+        return Codeword::IsValid(codeword) ? Codeword::Catalogue[(int)codeword].Description : "Unknown";
+    }
+
+    constexpr bool IsInvisible(Codeword::Type codeword)
+    {
+        return Codeword::IsValid(codeword) && Codeword::Catalogue[(int)codeword].Invisible;
     }
 
 } // namespace Codeword
@@ -10,6 +10,7 @@ const SDL_Color clrDB = {7, 7, 58, 0};
 const SDL_Color clrWH = {255, 255, 255, 0};
 const SDL_Color clrLB = {10, 100, 173, 0};
 const SDL_Color clrGN = {6, 74, 61, 0};
+const SDL_Color clrGR = {127, 127, 127, 0};
 
 const Uint32 intBK = 0x00000000;
 const Uint32 intRD = 0xFFFF0000;
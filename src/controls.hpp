@@ -43,9 +43,22 @@ namespace Control
         BUY,
         SELL,
         BARTER,
-        GENDER
+        GENDER,
+        REWIND,
+        First = ANY,
+        Last = REWIND
     };
 
+    // metadata table, indexed by Control::Type
+    constexpr const char *Names[] = {"ANY", "ABOUT", "SCROLL_UP", "SCROLL_DOWN", "MAP", "CHART", "CHARACTER", "GAME", "NEW", "CUSTOM", "LOAD", "SAVE", "SHOP", "NEXT", "GLOSSARY", "ACTION", "BACK", "USE", "DROP", "CONFIRM", "QUIT", "PLUS", "MINUS", "TRADE", "GIVE", "STEAL", "LOSE", "YES", "NO", "BUY", "SELL", "BARTER", "GENDER", "REWIND"};
+
+    static_assert(sizeof(Control::Names) / sizeof(const char *) == (int)Control::Type::Last + 1, "every control type needs its own entry in Control::Names, in enum order");
+
+    constexpr const char *Name(Control::Type control)
+    {
+        return (control >= Control::Type::First && control <= Control::Type::Last) ? Control::Names[(int)control] : "UNKNOWN";
+    }
+
     class Base
     {
     public:
@@ -0,0 +1,627 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "autoplay.hpp"
+#include "autosave.hpp"
+#include "core.hpp"
+#include "engine.hpp"
+#include "explorer.hpp"
+#include "hint.hpp"
+#include "journal.hpp"
+#include "regression.hpp"
+#include "savecheck.hpp"
+#include "savefile.hpp"
+#include "saveslot.hpp"
+
+namespace Core
+{
+    class Session
+    {
+    public:
+        Engine::Session Game = Engine::Session();
+
+        // answers to the current prompt, refreshed after every step
+        std::vector<Engine::Option> Options = std::vector<Engine::Option>();
+
+        std::string Text = std::string();
+    };
+
+    void REFRESH(Core::Session *session)
+    {
+        session->Options = Engine::OPTIONS(session->Game);
+    }
+
+    Core::Session *START(int character, int story)
+    {
+        Core::Session *session = NULL;
+
+        if (character >= 0 && character < Character::Classes.size())
+        {
+            session = new Core::Session();
+
+            Engine::START(session->Game, Character::Classes[character], story);
+
+            Core::REFRESH(session);
+        }
+
+        return session;
+    }
+
+    void STOP(Core::Session *session)
+    {
+        delete session;
+    }
+
+    int SECTION(Core::Session *session)
+    {
+        return session->Game.Section->ID;
+    }
+
+    int PROMPT(Core::Session *session)
+    {
+        return (int)session->Game.Prompt;
+    }
+
+    int ENDING(Core::Session *session)
+    {
+        return (int)session->Game.Ending;
+    }
+
+    int LIFE(Core::Session *session)
+    {
+        return session->Game.Player.Life;
+    }
+
+    int MONEY(Core::Session *session)
+    {
+        return session->Game.Player.Money;
+    }
+
+    int OPTIONS(Core::Session *session)
+    {
+        return session->Options.size();
+    }
+
+    const char *DESCRIBE(Core::Session *session, int option)
+    {
+        session->Text.clear();
+
+        if (option >= 0 && option < session->Options.size())
+        {
+            session->Text = Engine::DESCRIBE(session->Game, session->Options[option]);
+        }
+
+        return session->Text.c_str();
+    }
+
+    bool APPLY(Core::Session *session, int option)
+    {
+        auto result = false;
+
+        if (option >= 0 && option < session->Options.size())
+        {
+            result = Engine::APPLY(session->Game, session->Options[option]);
+
+            Core::REFRESH(session);
+        }
+
+        return result;
+    }
+
+    const char *PROMPT_NAME(int prompt)
+    {
+        return (prompt >= (int)Engine::Prompt::First && prompt <= (int)Engine::Prompt::Last) ? Engine::Prompts[prompt] : "UNKNOWN";
+    }
+
+    const char *ENDING_NAME(int ending)
+    {
+        return (ending >= (int)Engine::Ending::First && ending <= (int)Engine::Ending::Last) ? Engine::Endings[ending] : "UNKNOWN";
+    }
+
+    int CLASSES()
+    {
+        return Character::Classes.size();
+    }
+
+    const char *CLASS_NAME(int character)
+    {
+        return (character >= 0 && character < Character::Classes.size()) ? Character::Classes[character].Name : "UNKNOWN";
+    }
+
+    // plays a game taking the first legal option at every prompt and prints each step
+    int PLAY(int character, int story)
+    {
+        auto session = Core::START(character, story);
+
+        if (!session)
+        {
+            std::fprintf(stderr, "Unknown character class: %d\n", character);
+
+            return 1;
+        }
+
+        std::printf("%s\n", Core::CLASS_NAME(character));
+
+        auto steps = 0;
+
+        while (Core::PROMPT(session) != (int)Engine::Prompt::END && Core::OPTIONS(session) > 0 && steps < 10000)
+        {
+            std::printf("%03d [%s] %s (Life %d, Money %d)\n", Core::SECTION(session), Core::PROMPT_NAME(Core::PROMPT(session)), Core::DESCRIBE(session, 0), Core::LIFE(session), Core::MONEY(session));
+
+            Core::APPLY(session, 0);
+
+            steps++;
+        }
+
+        std::printf("%03d %s after %d steps\n", Core::SECTION(session), Core::ENDING_NAME(Core::ENDING(session)), steps);
+
+        Core::STOP(session);
+
+        return 0;
+    }
+
+    // explores every reachable state of one or all starting classes
+    int EXPLORE(int character, int threads, long long limit, int actions)
+    {
+        if (character >= Core::CLASSES())
+        {
+            std::fprintf(stderr, "Unknown character class: %d\n", character);
+
+            return 1;
+        }
+
+        auto classes = character >= 0 ? std::vector<Character::Base>({Character::Classes[character]}) : Character::Archetypes;
+
+        for (auto i = 0; i < classes.size(); i++)
+        {
+            auto start = std::chrono::steady_clock::now();
+
+            // a full search runs for a long time, stderr hears how far it has got
+            auto progress = [&](long long states, long long queued)
+            {
+                std::fprintf(stderr, "%s: %lld states, %lld queued, %.0fs\n", classes[i].Name, states, queued, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+            };
+
+            auto report = Explorer::EXPLORE(classes[i], 0, threads, limit, actions, progress);
+
+            auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::printf("%s: %lld states, %lld steps, %d sections, %lld key collisions, %.1f%% table hits, %.2fs%s\n", classes[i].Name, report.States, report.Steps, (int)report.Sections.size(), report.Collisions, report.HitRate * 100.0, elapsed, report.Truncated ? " (TRUNCATED)" : "");
+
+            for (auto ending = (int)Engine::Ending::GOOD; ending <= (int)Engine::Ending::Last; ending++)
+            {
+                if (report.Endings[ending] > 0)
+                {
+                    std::printf("  %-8s %10lld:", Core::ENDING_NAME(ending), report.Endings[ending]);
+
+                    for (auto &reached : report.Reached)
+                    {
+                        if (reached.second == ending)
+                        {
+                            std::printf(" %03d", reached.first);
+                        }
+                    }
+
+                    std::printf("\n");
+                }
+            }
+        }
+
+        return 0;
+    }
+
+    // plays random games and reports throughput, endings per class and the busiest sections
+    int AUTOPLAY(long long games, std::uint64_t seed, int threads)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        auto report = Autoplay::AUTOPLAY(games, seed, threads, 10000);
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("%lld games, %lld steps in %.2fs: %.0f games/s, %.1f sections per game\n", report.Games, report.Steps, elapsed, elapsed > 0 ? report.Games / elapsed : 0.0, report.Games > 0 ? (double)report.Sections / report.Games : 0.0);
+
+        for (auto i = 0; i < report.Endings.size(); i++)
+        {
+            std::printf("%-16s", Character::Archetypes[i].Name);
+
+            for (auto ending = (int)Engine::Ending::GOOD; ending <= (int)Engine::Ending::Last; ending++)
+            {
+                std::printf(" %s %lld", Core::ENDING_NAME(ending), report.Endings[i][ending]);
+            }
+
+            std::printf("\n");
+        }
+
+        std::printf("Most visited:");
+
+        for (auto &visit : report.TOP(10))
+        {
+            std::printf(" %03d (%lld)", visit.first, visit.second);
+        }
+
+        std::printf("\n");
+
+        for (auto i = 0; i < report.Failures.size(); i++)
+        {
+            auto &failure = report.Failures[i];
+
+            std::printf("FAILED game %lld (%s) at %03d: %s\n", failure.Game, Character::Archetypes[failure.Class].Name, failure.Section, failure.What.c_str());
+        }
+
+        return report.Failures.size() > 0 ? 1 : 0;
+    }
+
+    // asks the hint engine about a fresh character entering a section and prints what it found
+    int HINT(int character, int story, int budget)
+    {
+        if (character < 0 || character >= Core::CLASSES())
+        {
+            std::fprintf(stderr, "Unknown character class: %d\n", character);
+
+            return 1;
+        }
+
+        auto advisor = Hint::Advisor(18);
+
+        advisor.Budget = std::chrono::milliseconds(budget);
+
+        auto start = std::chrono::steady_clock::now();
+
+        advisor.REQUEST(story, Character::Classes[character]);
+
+        while (!advisor.DONE())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        auto hint = advisor.POLL();
+
+        std::printf("%s at %03d: %lld states, horizon %d, %.1f%% table hits, %.2fs\n", Core::CLASS_NAME(character), story, hint.States, hint.Horizon, advisor.Table.HIT_RATE() * 100.0, elapsed);
+
+        if (hint.Life >= 0)
+        {
+            std::printf("%s: choice %d in %03d wins with %d life left\n", hint.Proven ? "Best" : "Best found", hint.Choice, hint.Section, hint.Life);
+        }
+        else
+        {
+            std::printf("%s\n", hint.Proven ? "The game can no longer be won" : "No winning line found yet");
+        }
+
+        return 0;
+    }
+
+    // plays a session journal back as fast as the rules allow, repeat times over for benchmarking
+    int REPLAY(const char *file_name, int repeat)
+    {
+        auto bytes = Journal::READ(file_name);
+
+        auto replay = Journal::Replay();
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (auto i = 0; i < std::max(1, repeat); i++)
+        {
+            replay = Journal::REPLAY(bytes);
+        }
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        auto records = replay.Records * std::max(1, repeat);
+
+        std::printf("%lld records, %lld sections, %zu bytes in %.3fs: %.0f records/s\n", replay.Records, replay.Sections, bytes.size(), elapsed, elapsed > 0 ? records / elapsed : 0.0);
+
+        if (replay.Section)
+        {
+            std::printf("%03d %s (Life %d, Money %d)\n", replay.Section->ID, Core::ENDING_NAME((int)Engine::ENDING(replay.Player, replay.Section)), replay.Player.Life, replay.Player.Money);
+        }
+
+        std::printf("Mutations:");
+
+        for (auto i = 0; i < replay.Mutations.Counts.size(); i++)
+        {
+            if (replay.Mutations.Counts[i] > 0)
+            {
+                std::printf(" %s %lld", Mutation::Names[i], replay.Mutations.Counts[i]);
+            }
+        }
+
+        std::printf("\n");
+
+        if (!replay.Error.empty())
+        {
+            std::printf("DIVERGED after %lld records: %s\n", replay.Records, replay.Error.c_str());
+
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // enters every section with every archetype and reports the rules that broke
+    int REGRESS(int threads)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        auto report = Regression::REGRESS(threads);
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("%lld cases over %d sections in %.2fs: %zu failed\n", report.Cases, StoryGraph::SECTIONS, elapsed, report.Failures.size());
+
+        for (auto i = 0; i < report.Failures.size(); i++)
+        {
+            auto &failure = report.Failures[i];
+
+            std::printf("FAILED %03d (%s): %s\n", failure.Section, failure.Archetype.c_str(), failure.What.c_str());
+        }
+
+        return report.Failures.size() > 0 ? 1 : 0;
+    }
+
+    // reads a save in either format and writes it out again, as JSON when the output name ends in .json
+    int CONVERT(const char *input, const char *output, int repeat)
+    {
+        auto player = Character::Base();
+
+        auto json = std::strlen(output) > 5 && std::strcmp(output + std::strlen(output) - 5, ".json") == 0;
+
+        repeat = std::max(1, repeat);
+
+        auto status = SaveFile::Status::OK;
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (auto i = 0; i < repeat && status == SaveFile::Status::OK; i++)
+        {
+            status = SaveFile::LOAD(input, player);
+        }
+
+        auto loaded = std::chrono::steady_clock::now();
+
+        if (status != SaveFile::Status::OK)
+        {
+            std::fprintf(stderr, "Unable to load %s: %s\n", input, SaveFile::Statuses[(int)status]);
+
+            return 1;
+        }
+
+        auto saved = true;
+
+        for (auto i = 0; i < repeat && saved; i++)
+        {
+            saved = SaveFile::SAVE(output, player, json);
+        }
+
+        auto end = std::chrono::steady_clock::now();
+
+        if (!saved)
+        {
+            std::fprintf(stderr, "Unable to write %s\n", output);
+
+            return 1;
+        }
+
+        auto load = std::chrono::duration<double, std::micro>(loaded - start).count() / repeat;
+
+        auto save = std::chrono::duration<double, std::micro>(end - loaded).count() / repeat;
+
+        std::printf("%s at %03d (Life %d, Money %d): loaded in %.1fus, saved as %s in %.1fus\n", player.Name, player.StoryID, player.Life, player.Money, load, json ? "JSON" : "binary", save);
+
+        return 0;
+    }
+
+    // picks up the character from an autosave left behind by a crash, writing it out as a save if asked to
+    int RECOVER(const char *input, const char *output)
+    {
+        auto bytes = std::string();
+
+        if (!SaveFile::READ(input, bytes))
+        {
+            std::fprintf(stderr, "Unable to read %s\n", input);
+
+            return 1;
+        }
+
+        auto recovery = Autosave::RECOVER(bytes);
+
+        std::printf("%d records, %zu bytes, %zu discarded\n", recovery.Records, bytes.size(), recovery.Discarded);
+
+        if (!recovery.Good)
+        {
+            std::printf("Nothing to recover\n");
+
+            return 1;
+        }
+
+        std::printf("%s at %03d (Life %d, Money %d)\n", recovery.Player.Name, recovery.Player.StoryID, recovery.Player.Life, recovery.Player.Money);
+
+        if (output && !SaveFile::SAVE(output, recovery.Player))
+        {
+            std::fprintf(stderr, "Unable to write %s\n", output);
+
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // checks every save in a directory, rewriting sound JSON saves in the binary format when asked to
+    int VALIDATE(const char *directory, int threads, bool migrate)
+    {
+        auto files = SaveCheck::FILES(directory);
+
+        auto start = std::chrono::steady_clock::now();
+
+        auto report = SaveCheck::VALIDATE(files, threads, migrate);
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        for (auto i = 0; i < report.Problems.size(); i++)
+        {
+            auto &problem = report.Problems[i];
+
+            std::printf("INVALID %s: %s\n", problem.File.c_str(), problem.What.c_str());
+        }
+
+        std::printf("%lld saves (%lld binary, %lld JSON, %lld autosaves, %lld slots) in %.2fs, %.0f saves/s: %lld invalid, %lld migrated\n", report.Files, report.Binary, report.JSON, report.Autosaves, report.Slots, elapsed, elapsed > 0 ? report.Files / elapsed : 0.0, report.Invalid, report.Migrated);
+
+        return report.Invalid > 0 ? 1 : 0;
+    }
+
+    // lists the saves in a slot, or rebuilds one of them and writes it out as a save of its own if asked to
+    int SLOT(const char *input, int save, const char *output)
+    {
+        auto slot = SaveSlot::Slot();
+
+        auto status = SaveSlot::READ(input, slot);
+
+        if (status != SaveFile::Status::OK)
+        {
+            std::fprintf(stderr, "Unable to read %s: %s\n", input, SaveFile::Statuses[(int)status]);
+
+            return 1;
+        }
+
+        if (save < 0)
+        {
+            for (auto i = 0; i < slot.Entries.size(); i++)
+            {
+                auto &entry = slot.Entries[i];
+
+                std::printf("%4d %s %03d %lld (%zu bytes)\n", i, entry.Keyframe ? "KEYFRAME" : "DELTA   ", entry.Section, (long long)entry.Epoch, entry.Length);
+            }
+
+            std::printf("%zu saves in %zu bytes of records, %zu bytes of thumbnail\n", slot.Entries.size(), slot.Records.size(), slot.Picture.size());
+
+            return 0;
+        }
+
+        auto player = Character::Base();
+
+        auto start = std::chrono::steady_clock::now();
+
+        status = slot.LOAD(save, player);
+
+        auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        if (status != SaveFile::Status::OK)
+        {
+            std::fprintf(stderr, "Unable to rebuild save %d: %s\n", save, SaveFile::Statuses[(int)status]);
+
+            return 1;
+        }
+
+        std::printf("%s at %03d (Life %d, Money %d): rebuilt in %.1fus\n", player.Name, player.StoryID, player.Life, player.Money, elapsed);
+
+        if (output && !SaveFile::SAVE(output, player))
+        {
+            std::fprintf(stderr, "Unable to write %s\n", output);
+
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // whether a --name argument was given
+    bool FLAG(int argc, char **argv, const char *name)
+    {
+        for (auto i = 1; i < argc; i++)
+        {
+            if (std::strcmp(argv[i], name) == 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // value following a --name argument
+    long long VALUE(int argc, char **argv, const char *name, long long value)
+    {
+        for (auto i = 1; i < argc - 1; i++)
+        {
+            if (std::strcmp(argv[i], name) == 0)
+            {
+                value = std::atoll(argv[i + 1]);
+            }
+        }
+
+        return value;
+    }
+
+    void USAGE(const char *program)
+    {
+        std::fprintf(stderr, "Usage: %s --play <class 0-%d> [section]\n", program, Core::CLASSES() - 1);
+        std::fprintf(stderr, "       %s --explore <class|all> [--threads T] [--states N] [--actions A]\n", program);
+        std::fprintf(stderr, "       %s --autoplay <games> [--seed S] [--threads T]\n", program);
+        std::fprintf(stderr, "       %s --hint <class> [section] [--budget ms]\n", program);
+        std::fprintf(stderr, "       %s --replay <journal> [--repeat N]\n", program);
+        std::fprintf(stderr, "       %s --regress [--threads T]\n", program);
+        std::fprintf(stderr, "       %s --convert <save> <output[.json]> [--repeat N]\n", program);
+        std::fprintf(stderr, "       %s --recover <autosave> [save]\n", program);
+        std::fprintf(stderr, "       %s --validate <directory> [--migrate] [--threads T]\n", program);
+        std::fprintf(stderr, "       %s --slot <slot> [save] [output]\n", program);
+    }
+
+    int RUN(int argc, char **argv)
+    {
+        auto threads = (int)Core::VALUE(argc, argv, "--threads", std::max(1U, std::thread::hardware_concurrency()));
+
+        if (argc > 2 && std::strcmp(argv[1], "--play") == 0)
+        {
+            return Core::PLAY(std::atoi(argv[2]), argc > 3 ? std::atoi(argv[3]) : 0);
+        }
+        else if (argc > 2 && std::strcmp(argv[1], "--explore") == 0)
+        {
+            auto character = std::strcmp(argv[2], "all") == 0 ? -1 : std::atoi(argv[2]);
+
+            return Core::EXPLORE(character, threads, Core::VALUE(argc, argv, "--states", 0), (int)Core::VALUE(argc, argv, "--actions", -1));
+        }
+        else if (argc > 2 && std::strcmp(argv[1], "--autoplay") == 0)
+        {
+            return Core::AUTOPLAY(std::atoll(argv[2]), (std::uint64_t)Core::VALUE(argc, argv, "--seed", 1), threads);
+        }
+        else if (argc > 2 && std::strcmp(argv[1], "--hint") == 0)
+        {
+            return Core::HINT(std::atoi(argv[2]), (argc > 3 && argv[3][0] != '-') ? std::atoi(argv[3]) : 0, (int)Core::VALUE(argc, argv, "--budget", 2000));
+        }
+        else if (argc > 2 && std::strcmp(argv[1], "--replay") == 0)
+        {
+            return Core::REPLAY(argv[2], (int)Core::VALUE(argc, argv, "--repeat", 1));
+        }
+        else if (argc > 1 && std::strcmp(argv[1], "--regress") == 0)
+        {
+            return Core::REGRESS(threads);
+        }
+        else if (argc > 3 && std::strcmp(argv[1], "--convert") == 0)
+        {
+            return Core::CONVERT(argv[2], argv[3], (int)Core::VALUE(argc, argv, "--repeat", 1));
+        }
+        else if (argc > 2 && std::strcmp(argv[1], "--recover") == 0)
+        {
+            return Core::RECOVER(argv[2], (argc > 3 && argv[3][0] != '-') ? argv[3] : NULL);
+        }
+        else if (argc > 2 && std::strcmp(argv[1], "--validate") == 0)
+        {
+            return Core::VALIDATE(argv[2], threads, Core::FLAG(argc, argv, "--migrate"));
+        }
+        else if (argc > 2 && std::strcmp(argv[1], "--slot") == 0)
+        {
+            return Core::SLOT(argv[2], argc > 3 ? std::atoi(argv[3]) : -1, argc > 4 ? argv[4] : NULL);
+        }
+
+        Core::USAGE(argv[0]);
+
+        return 1;
+    }
+} // namespace Core
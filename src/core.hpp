@@ -0,0 +1,48 @@
+#ifndef __CORE__HPP__
+#define __CORE__HPP__
+
+// Public interface of libdeadmen_core: the game rules without SDL, for headless simulation and tools
+namespace Core
+{
+    // a game in progress, see Engine::Session
+    class Session;
+
+    // character is an index into Character::Classes
+    Core::Session *START(int character, int story);
+
+    void STOP(Core::Session *session);
+
+    // current section
+    int SECTION(Core::Session *session);
+
+    // Engine::Prompt the game is waiting for
+    int PROMPT(Core::Session *session);
+
+    // Engine::Ending once the prompt is END
+    int ENDING(Core::Session *session);
+
+    int LIFE(Core::Session *session);
+
+    int MONEY(Core::Session *session);
+
+    // number of legal answers to the current prompt
+    int OPTIONS(Core::Session *session);
+
+    const char *DESCRIBE(Core::Session *session, int option);
+
+    // answers the current prompt with one of its options
+    bool APPLY(Core::Session *session, int option);
+
+    const char *PROMPT_NAME(int prompt);
+
+    const char *ENDING_NAME(int ending);
+
+    int CLASSES();
+
+    const char *CLASS_NAME(int character);
+
+    // command line tools, returns the exit code
+    int RUN(int argc, char **argv);
+} // namespace Core
+
+#endif
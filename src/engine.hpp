@@ -0,0 +1,1030 @@
+#ifndef __ENGINE__HPP__
+#define __ENGINE__HPP__
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "character.hpp"
+#include "choices.hpp"
+#include "items.hpp"
+#include "skills.hpp"
+#include "smallvector.hpp"
+#include "story.hpp"
+
+// Game rules without any rendering: the SDL frontend and the headless tools both drive the game through here
+namespace Engine
+{
+    // what the game is waiting for
+    enum class Prompt
+    {
+        NONE = 0,
+        ACTION,      // optional buying, selling, trading or item use before moving on
+        LOSE_SKILLS, // lose skills down to a limit
+        TAKE,        // take items from a pile, up to a limit
+        LOSE,        // give up items from a section's list
+        DROP,        // carrying too much, leave items behind
+        CHOICE,      // pick one of the section's choices
+        GIVE,        // hand over items after a choice
+        BRIBE,       // hand over items of the listed kinds after a choice
+        END,         // the adventure is over
+        First = NONE,
+        Last = END
+    };
+
+    enum class Ending
+    {
+        NONE = 0,
+        GOOD,
+        DOOM,
+        PIRACY,
+        DEATH,
+        MISSING, // reached a section that is not implemented
+        STUCK,   // no choice can be taken
+        LOOP,    // sections keep jumping to each other without asking the player anything
+        First = NONE,
+        Last = LOOP
+    };
+
+    enum class Action
+    {
+        NEXT = 0,
+        BUY,
+        SELL,
+        TRADE,
+        USE
+    };
+
+    // outcome of buying, selling, trading and using items
+    enum class Result
+    {
+        OK = 0,
+        NO_MONEY,
+        DUPLICATE,
+        NO_ITEM,
+        NOT_INJURED,
+        UNUSABLE
+    };
+
+    constexpr const char *Endings[] = {"NONE", "GOOD", "DOOM", "PIRACY", "DEATH", "MISSING", "STUCK", "LOOP"};
+
+    static_assert(sizeof(Engine::Endings) / sizeof(const char *) == (int)Engine::Ending::Last + 1, "every ending needs its own entry in Engine::Endings, in enum order");
+
+    constexpr const char *Prompts[] = {"NONE", "ACTION", "LOSE_SKILLS", "TAKE", "LOSE", "DROP", "CHOICE", "GIVE", "BRIBE", "END"};
+
+    static_assert(sizeof(Engine::Prompts) / sizeof(const char *) == (int)Engine::Prompt::Last + 1, "every prompt needs its own entry in Engine::Prompts, in enum order");
+
+    // limit on automatic jumps (backgrounds and sections without choices) before the game is considered stuck in a loop
+    const int JUMP_LIMIT = 1000;
+
+    // positions in an item or skill list
+    typedef SmallVector<int, 8> Selection;
+
+    // one legal answer to the current prompt
+    class Option
+    {
+    public:
+        Engine::Prompt Type = Engine::Prompt::NONE;
+
+        Engine::Action Action = Engine::Action::NEXT;
+
+        // choice, shop entry or inventory position
+        int Index = -1;
+
+        Engine::Selection Selection = Engine::Selection();
+
+        Option()
+        {
+        }
+
+        Option(Engine::Prompt type, int index)
+        {
+            Type = type;
+            Index = index;
+        }
+
+        Option(Engine::Action action, int index)
+        {
+            Type = Engine::Prompt::ACTION;
+            Action = action;
+            Index = index;
+        }
+
+        Option(Engine::Prompt type, Engine::Selection selection)
+        {
+            Type = type;
+            Selection = selection;
+        }
+    };
+
+    class Session
+    {
+    public:
+        Character::Base Player = Character::Base();
+
+        Story::Base *Section = NULL;
+
+        Engine::Prompt Prompt = Engine::Prompt::NONE;
+
+        Engine::Ending Ending = Engine::Ending::NONE;
+
+        // choice whose follow-up (take, give, bribe, lose skills, drop) is still pending
+        int Pending = -1;
+
+        // optional actions taken in the current section
+        int Actions = 0;
+
+        // optional actions offered per section, 0 skips the ACTION prompt altogether and -1 leaves it to money and stock
+        int ActionLimit = 1;
+
+        // sections entered so far
+        int Sections = 0;
+
+        // stop before entering the next section instead of following it, see RESUME
+        bool Hold = false;
+
+        // section waiting to be entered while on hold
+        int Next = -1;
+    };
+
+    Story::Base *FIND(int id)
+    {
+        if (Stories.size() == 0)
+        {
+            InitializeStories();
+        }
+
+        return (Story::Base *)findStory(id);
+    }
+
+    // runs background jumps and the section's event, returns the section the player ends up in
+    Story::Base *ENTER(Character::Base &player, Story::Base *story)
+    {
+        player.StoryID = story->ID;
+
+        auto jump = story->Background(player);
+
+        for (auto i = 0; jump >= 0 && i < Engine::JUMP_LIMIT; i++)
+        {
+            story = Engine::FIND(jump);
+
+            player.StoryID = story->ID;
+
+            jump = story->Background(player);
+        }
+
+        story->Event(player);
+
+        return story;
+    }
+
+    Engine::Ending ENDING(Character::Base &player, Story::Base *story)
+    {
+        auto ending = Engine::Ending::NONE;
+
+        if (story == NULL || story == &notImplemented)
+        {
+            ending = Engine::Ending::MISSING;
+        }
+        else if (story->Type == Story::Type::DOOM)
+        {
+            ending = Engine::Ending::DOOM;
+        }
+        else if (player.Life <= 0)
+        {
+            ending = Engine::Ending::DEATH;
+        }
+        else if (story->Type == Story::Type::PIRACY)
+        {
+            ending = Engine::Ending::PIRACY;
+        }
+        else if (story->Type == Story::Type::GOOD)
+        {
+            ending = Engine::Ending::GOOD;
+        }
+
+        return ending;
+    }
+
+    // section the player goes to once a choice has been resolved
+    Story::Base *DESTINATION(Character::Base &player, Story::Base *story, Choice::Base &choice)
+    {
+        Story::Base *next = &notImplemented;
+
+        if (player.Life > 0)
+        {
+            next = choice.Destination != story->ID ? Engine::FIND(choice.Destination) : story;
+        }
+
+        return next;
+    }
+
+    // Primitives shared by the screens and the step API
+
+    // returns the items actually taken
+    Item::List TAKE(Character::Base &player, const Item::List &items, const Engine::Selection &selection, int limit)
+    {
+        auto take = Item::List();
+
+        for (auto i = 0; i < selection.size() && i < limit; i++)
+        {
+            if (selection[i] >= 0 && selection[i] < items.size())
+            {
+                take.push_back(items[selection[i]]);
+            }
+        }
+
+        Character::GET_ITEMS(player, take);
+
+        return take;
+    }
+
+    // gives up the kinds of items selected from a list that is not the inventory
+    void LOSE(Character::Base &player, const Item::List &items, const Engine::Selection &selection)
+    {
+        for (auto i = 0; i < selection.size(); i++)
+        {
+            if (selection[i] >= 0 && selection[i] < items.size())
+            {
+                Character::LOSE_ITEMS(player, {items[selection[i]].Type});
+            }
+        }
+    }
+
+    void DROP(Character::Base &player, const Engine::Selection &selection)
+    {
+        Character::DROP_ITEMS(player, selection.vector());
+    }
+
+    // only items of the listed kinds are accepted
+    void BRIBE(Character::Base &player, const std::vector<Item::Type> &types, const Engine::Selection &selection)
+    {
+        auto accepted = std::vector<int>();
+
+        for (auto i = 0; i < selection.size(); i++)
+        {
+            if (selection[i] >= 0 && selection[i] < player.Items.size() && std::find(types.begin(), types.end(), player.Items[selection[i]].Type) != types.end())
+            {
+                accepted.push_back(selection[i]);
+            }
+        }
+
+        Character::DROP_ITEMS(player, accepted);
+    }
+
+    void LOSE_SKILLS(Character::Base &player, const Engine::Selection &selection)
+    {
+        auto skills = std::vector<Skill::Type>();
+
+        for (auto i = 0; i < selection.size(); i++)
+        {
+            if (selection[i] >= 0 && selection[i] < player.Skills.size())
+            {
+                skills.push_back(player.Skills[selection[i]].Type);
+            }
+        }
+
+        Character::LOSE_SKILLS(player, skills);
+    }
+
+    Engine::Result BUY(Character::Base &player, const Item::Base &item, int price)
+    {
+        auto result = Engine::Result::OK;
+
+        if (player.Money < price)
+        {
+            result = Engine::Result::NO_MONEY;
+        }
+        else if (Item::IsUnique(item.Type) && Character::VERIFY_ITEMS(player, {item.Type}))
+        {
+            result = Engine::Result::DUPLICATE;
+        }
+        else
+        {
+            Character::GET_ITEMS(player, {item});
+
+            Character::GAIN_MONEY(player, -price);
+        }
+
+        return result;
+    }
+
+    // sells the least charged item of that kind
+    Engine::Result SELL(Character::Base &player, const Item::Base &item, int price)
+    {
+        auto result = Engine::Result::OK;
+
+        if (Item::FIND_TYPE(player.Items, item.Type) < 0)
+        {
+            result = Engine::Result::NO_ITEM;
+        }
+        else
+        {
+            Character::GAIN_MONEY(player, price);
+
+            if (Item::COUNT_TYPES(player.Items, item.Type) > 1)
+            {
+                auto least = Item::FIND_LEAST(player.Items, item.Type);
+
+                if (least >= 0)
+                {
+                    Character::DROP_ITEMS(player, {least});
+                }
+            }
+            else
+            {
+                Character::LOSE_ITEMS(player, {item.Type});
+            }
+        }
+
+        return result;
+    }
+
+    Engine::Result TRADE(Character::Base &player, const Item::Base &mine, const Item::Base &theirs)
+    {
+        auto result = Engine::Result::OK;
+
+        if (!Character::VERIFY_ITEMS(player, {mine.Type}))
+        {
+            result = Engine::Result::NO_ITEM;
+        }
+        else
+        {
+            Character::LOSE_ITEMS(player, {mine.Type});
+
+            Character::GET_ITEMS(player, {theirs});
+        }
+
+        return result;
+    }
+
+    // uses the item at that position in the inventory
+    Engine::Result USE(Character::Base &player, int index)
+    {
+        auto result = Engine::Result::UNUSABLE;
+
+        if (index >= 0 && index < player.Items.size() && player.Items[index].Type == Item::Type::HEALING_POTION)
+        {
+            if (player.Life < player.MAX_LIFE_LIMIT)
+            {
+                Character::GAIN_LIFE(player, player.MAX_LIFE_LIMIT);
+
+                Character::DROP_ITEMS(player, {index});
+
+                result = Engine::Result::OK;
+            }
+            else
+            {
+                result = Engine::Result::NOT_INJURED;
+            }
+        }
+
+        return result;
+    }
+
+    // Step API
+
+    // whether the section has a shop, trade or potion to offer, however many actions have been taken
+    bool OFFERS_ACTIONS(Engine::Session &session)
+    {
+        auto &player = session.Player;
+
+        auto story = session.Section;
+
+        auto shop = story->Controls == Story::Controls::SHOP || story->Controls == Story::Controls::BUY_AND_SELL;
+
+        auto sell = story->Controls == Story::Controls::SELL || story->Controls == Story::Controls::BUY_AND_SELL;
+
+        auto trade = story->Controls == Story::Controls::TRADE;
+
+        auto heal = player.Life < player.MAX_LIFE_LIMIT && Character::VERIFY_ITEMS(player, {Item::Type::HEALING_POTION});
+
+        return (shop && story->Shop.size() > 0) || (sell && story->Sell.size() > 0) || trade || heal;
+    }
+
+    bool HAS_ACTIONS(Engine::Session &session)
+    {
+        return (session.ActionLimit < 0 || session.Actions < session.ActionLimit) && Engine::OFFERS_ACTIONS(session);
+    }
+
+    // first prompt in section order that comes after the given one, NONE if the section has nothing more to ask
+    Engine::Prompt NEXT(Engine::Session &session, Engine::Prompt after)
+    {
+        auto &player = session.Player;
+
+        auto story = session.Section;
+
+        auto prompt = Engine::Prompt::NONE;
+
+        if (Engine::ENDING(player, story) != Engine::Ending::NONE)
+        {
+            prompt = Engine::Prompt::END;
+        }
+        else if (session.Pending >= 0)
+        {
+            if (after < Engine::Prompt::DROP && !Character::VERIFY_POSSESSIONS(player))
+            {
+                prompt = Engine::Prompt::DROP;
+            }
+        }
+        else if (after < Engine::Prompt::ACTION && Engine::HAS_ACTIONS(session))
+        {
+            prompt = Engine::Prompt::ACTION;
+        }
+        else if (after < Engine::Prompt::LOSE_SKILLS && story->LimitSkills > 0 && player.Skills.size() > story->LimitSkills)
+        {
+            prompt = Engine::Prompt::LOSE_SKILLS;
+        }
+        else if (after < Engine::Prompt::TAKE && story->Take.size() > 0 && story->Limit > 0)
+        {
+            prompt = Engine::Prompt::TAKE;
+        }
+        else if (after < Engine::Prompt::LOSE && story->Limit > 0 && story->ToLose.size() > story->Limit)
+        {
+            prompt = Engine::Prompt::LOSE;
+        }
+        else if (after < Engine::Prompt::DROP && !Character::VERIFY_POSSESSIONS(player))
+        {
+            prompt = Engine::Prompt::DROP;
+        }
+        else if (after < Engine::Prompt::CHOICE && story->Choices.size() > 0)
+        {
+            prompt = Engine::Prompt::CHOICE;
+        }
+
+        return prompt;
+    }
+
+    bool CAN_CHOOSE(Engine::Session &session)
+    {
+        auto &choices = session.Section->Choices;
+
+        for (auto i = 0; i < choices.size(); i++)
+        {
+            if (Choice::AVAILABLE(session.Player, choices[i]))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void ENTER(Engine::Session &session, Story::Base *story)
+    {
+        session.Section = Engine::ENTER(session.Player, story);
+
+        session.Pending = -1;
+
+        session.Actions = 0;
+
+        session.Sections++;
+    }
+
+    void STOP(Engine::Session &session, Engine::Ending ending)
+    {
+        session.Prompt = Engine::Prompt::END;
+
+        session.Ending = ending;
+    }
+
+    // moves on to the next prompt, following jumps that do not need the player
+    void ADVANCE(Engine::Session &session, Engine::Prompt after)
+    {
+        for (auto jumps = 0; jumps <= Engine::JUMP_LIMIT; jumps++)
+        {
+            session.Prompt = Engine::NEXT(session, after);
+
+            if (session.Prompt == Engine::Prompt::END)
+            {
+                session.Ending = Engine::ENDING(session.Player, session.Section);
+
+                return;
+            }
+            else if (session.Prompt == Engine::Prompt::CHOICE && !Engine::CAN_CHOOSE(session))
+            {
+                Engine::STOP(session, Engine::Ending::STUCK);
+
+                return;
+            }
+            else if (session.Prompt != Engine::Prompt::NONE)
+            {
+                return;
+            }
+
+            Story::Base *next = NULL;
+
+            if (session.Pending >= 0)
+            {
+                auto &choice = session.Section->Choices[session.Pending];
+
+                next = Engine::DESTINATION(session.Player, session.Section, choice);
+
+                if (next == session.Section)
+                {
+                    // stay and ask again, without re-running the section's event
+                    session.Pending = -1;
+
+                    after = Engine::Prompt::DROP;
+
+                    continue;
+                }
+            }
+            else
+            {
+                next = Engine::FIND(session.Section->Continue(session.Player));
+            }
+
+            if (session.Hold)
+            {
+                session.Next = next->ID;
+
+                return;
+            }
+
+            Engine::ENTER(session, next);
+
+            after = Engine::Prompt::NONE;
+        }
+
+        Engine::STOP(session, Engine::Ending::LOOP);
+    }
+
+    // enters a section and moves on to its first prompt
+    void RESUME(Engine::Session &session, int id)
+    {
+        session.Next = -1;
+
+        Engine::ENTER(session, Engine::FIND(id));
+
+        Engine::ADVANCE(session, Engine::Prompt::NONE);
+    }
+
+    void START(Engine::Session &session, Character::Base player, int id)
+    {
+        session.Player = player;
+
+        session.Prompt = Engine::Prompt::NONE;
+
+        session.Ending = Engine::Ending::NONE;
+
+        session.Sections = 0;
+
+        Engine::RESUME(session, id);
+    }
+
+    // items, how many of them may be picked and how many must be picked at the current prompt
+    const Item::List &PILE(Engine::Session &session, int &least, int &most)
+    {
+        auto &player = session.Player;
+
+        auto story = session.Section;
+
+        least = 0;
+
+        most = 0;
+
+        if (session.Prompt == Engine::Prompt::TAKE)
+        {
+            if (session.Pending >= 0)
+            {
+                auto &choice = story->Choices[session.Pending];
+
+                most = choice.Value;
+
+                return choice.Items;
+            }
+
+            most = story->Limit;
+
+            return story->Take;
+        }
+        else if (session.Prompt == Engine::Prompt::LOSE)
+        {
+            least = most = story->ToLose.size() - story->Limit;
+
+            return story->ToLose;
+        }
+        else if (session.Prompt == Engine::Prompt::DROP)
+        {
+            least = most = player.Items.size() - player.ITEM_LIMIT;
+        }
+        else if (session.Prompt == Engine::Prompt::GIVE || session.Prompt == Engine::Prompt::BRIBE)
+        {
+            least = most = story->Choices[session.Pending].Value;
+        }
+
+        return player.Items;
+    }
+
+    std::uint64_t KEY(const Item::Base &item)
+    {
+        return ((std::uint64_t)item.Type << 32) | ((std::uint64_t)item.Variant << 16) | (std::uint16_t)item.Charge;
+    }
+
+    // every way of picking between least and most of the candidates, in increasing index order
+    std::vector<Engine::Selection> COMBINATIONS(const std::vector<int> &candidates, int least, int most)
+    {
+        auto combinations = std::vector<Engine::Selection>();
+
+        if (most > candidates.size())
+        {
+            most = candidates.size();
+        }
+
+        for (auto count = least; count <= most; count++)
+        {
+            auto picks = std::vector<int>(count);
+
+            for (auto i = 0; i < count; i++)
+            {
+                picks[i] = i;
+            }
+
+            while (true)
+            {
+                auto selection = Engine::Selection();
+
+                for (auto i = 0; i < count; i++)
+                {
+                    selection.push_back(candidates[picks[i]]);
+                }
+
+                combinations.push_back(selection);
+
+                auto i = count - 1;
+
+                while (i >= 0 && picks[i] == candidates.size() - count + i)
+                {
+                    i--;
+                }
+
+                if (i < 0)
+                {
+                    break;
+                }
+
+                picks[i]++;
+
+                for (auto j = i + 1; j < count; j++)
+                {
+                    picks[j] = picks[j - 1] + 1;
+                }
+            }
+        }
+
+        return combinations;
+    }
+
+    // distinct ways of picking items, optionally only of the listed kinds
+    std::vector<Engine::Selection> PICKS(const Item::List &items, int least, int most, const std::vector<Item::Type> &types)
+    {
+        auto picks = std::vector<Engine::Selection>();
+
+        auto candidates = std::vector<int>();
+
+        for (auto i = 0; i < items.size(); i++)
+        {
+            if (types.size() == 0 || std::find(types.begin(), types.end(), items[i].Type) != types.end())
+            {
+                candidates.push_back(i);
+            }
+        }
+
+        auto combinations = Engine::COMBINATIONS(candidates, least, most);
+
+        auto seen = std::vector<std::vector<std::uint64_t>>();
+
+        for (auto i = 0; i < combinations.size(); i++)
+        {
+            auto keys = std::vector<std::uint64_t>();
+
+            for (auto j = 0; j < combinations[i].size(); j++)
+            {
+                keys.push_back(Engine::KEY(items[combinations[i][j]]));
+            }
+
+            std::sort(keys.begin(), keys.end());
+
+            // identical items picked from different positions lead to the same state
+            if (std::find(seen.begin(), seen.end(), keys) == seen.end())
+            {
+                seen.push_back(keys);
+
+                picks.push_back(combinations[i]);
+            }
+        }
+
+        return picks;
+    }
+
+    // every legal answer to the current prompt
+    std::vector<Engine::Option> OPTIONS(Engine::Session &session)
+    {
+        auto options = std::vector<Engine::Option>();
+
+        auto &player = session.Player;
+
+        auto story = session.Section;
+
+        auto prompt = session.Prompt;
+
+        if (prompt == Engine::Prompt::CHOICE)
+        {
+            auto available = Choice::EVALUATE(player, story->Choices);
+
+            for (auto i = 0; i < available.size(); i++)
+            {
+                if (available[i])
+                {
+                    options.push_back(Engine::Option(prompt, i));
+                }
+            }
+        }
+        else if (prompt == Engine::Prompt::ACTION)
+        {
+            options.push_back(Engine::Option(Engine::Action::NEXT, -1));
+
+            if (story->Controls == Story::Controls::SHOP || story->Controls == Story::Controls::BUY_AND_SELL)
+            {
+                for (auto i = 0; i < story->Shop.size(); i++)
+                {
+                    auto &item = story->Shop[i].first;
+
+                    if (player.Money >= story->Shop[i].second && !(Item::IsUnique(item.Type) && Character::VERIFY_ITEMS(player, {item.Type})))
+                    {
+                        options.push_back(Engine::Option(Engine::Action::BUY, i));
+                    }
+                }
+            }
+
+            if (story->Controls == Story::Controls::SELL || story->Controls == Story::Controls::BUY_AND_SELL)
+            {
+                for (auto i = 0; i < story->Sell.size(); i++)
+                {
+                    if (Item::FIND_TYPE(player.Items, story->Sell[i].first.Type) >= 0)
+                    {
+                        options.push_back(Engine::Option(Engine::Action::SELL, i));
+                    }
+                }
+            }
+
+            if (story->Controls == Story::Controls::TRADE && Character::VERIFY_ITEMS(player, {story->Trade.first.Type}))
+            {
+                options.push_back(Engine::Option(Engine::Action::TRADE, -1));
+            }
+
+            if (player.Life < player.MAX_LIFE_LIMIT)
+            {
+                auto potion = Item::FIND_TYPE(player.Items, Item::Type::HEALING_POTION);
+
+                if (potion >= 0)
+                {
+                    options.push_back(Engine::Option(Engine::Action::USE, potion));
+                }
+            }
+        }
+        else if (prompt == Engine::Prompt::LOSE_SKILLS)
+        {
+            auto limit = session.Pending >= 0 ? story->Choices[session.Pending].Value : story->LimitSkills;
+
+            auto count = (int)player.Skills.size() - limit;
+
+            auto skills = std::vector<int>();
+
+            for (auto i = 0; i < player.Skills.size(); i++)
+            {
+                skills.push_back(i);
+            }
+
+            auto combinations = Engine::COMBINATIONS(skills, count, count);
+
+            for (auto i = 0; i < combinations.size(); i++)
+            {
+                options.push_back(Engine::Option(prompt, combinations[i]));
+            }
+        }
+        else if (prompt == Engine::Prompt::TAKE || prompt == Engine::Prompt::LOSE || prompt == Engine::Prompt::DROP || prompt == Engine::Prompt::GIVE || prompt == Engine::Prompt::BRIBE)
+        {
+            auto least = 0;
+
+            auto most = 0;
+
+            auto &items = Engine::PILE(session, least, most);
+
+            auto types = prompt == Engine::Prompt::BRIBE ? Choice::TYPES(story->Choices[session.Pending]) : std::vector<Item::Type>();
+
+            auto combinations = Engine::PICKS(items, least, most, types);
+
+            for (auto i = 0; i < combinations.size(); i++)
+            {
+                options.push_back(Engine::Option(prompt, combinations[i]));
+            }
+        }
+
+        return options;
+    }
+
+    // resolves a choice, returns the prompt that has to be answered before the choice is complete
+    Engine::Prompt CHOOSE(Engine::Session &session, int index)
+    {
+        auto &player = session.Player;
+
+        auto &choice = session.Section->Choices[index];
+
+        auto interaction = Choice::APPLY(player, choice);
+
+        auto prompt = Engine::Prompt::NONE;
+
+        if (interaction == Choice::Interaction::TAKE)
+        {
+            prompt = Engine::Prompt::TAKE;
+        }
+        else if (interaction == Choice::Interaction::GIVE)
+        {
+            prompt = Engine::Prompt::GIVE;
+        }
+        else if (interaction == Choice::Interaction::BRIBE)
+        {
+            prompt = Engine::Prompt::BRIBE;
+        }
+        else if (interaction == Choice::Interaction::LOSE_SKILLS && player.Skills.size() > choice.Value)
+        {
+            prompt = Engine::Prompt::LOSE_SKILLS;
+        }
+
+        session.Pending = index;
+
+        return prompt;
+    }
+
+    // answers the current prompt, returns false if the option does not belong to it
+    bool APPLY(Engine::Session &session, const Engine::Option &option)
+    {
+        auto &player = session.Player;
+
+        auto story = session.Section;
+
+        auto prompt = session.Prompt;
+
+        if (option.Type != prompt || prompt == Engine::Prompt::END || prompt == Engine::Prompt::NONE)
+        {
+            return false;
+        }
+
+        if (prompt == Engine::Prompt::CHOICE)
+        {
+            if (option.Index < 0 || option.Index >= story->Choices.size() || !Choice::AVAILABLE(player, story->Choices[option.Index]))
+            {
+                return false;
+            }
+
+            auto next = Engine::CHOOSE(session, option.Index);
+
+            if (next != Engine::Prompt::NONE)
+            {
+                session.Prompt = next;
+
+                return true;
+            }
+        }
+        else if (prompt == Engine::Prompt::ACTION)
+        {
+            auto result = Engine::Result::OK;
+
+            if (option.Action == Engine::Action::NEXT)
+            {
+                Engine::ADVANCE(session, prompt);
+
+                return true;
+            }
+            else if (option.Action == Engine::Action::BUY && option.Index >= 0 && option.Index < story->Shop.size())
+            {
+                result = Engine::BUY(player, story->Shop[option.Index].first, story->Shop[option.Index].second);
+            }
+            else if (option.Action == Engine::Action::SELL && option.Index >= 0 && option.Index < story->Sell.size())
+            {
+                result = Engine::SELL(player, story->Sell[option.Index].first, story->Sell[option.Index].second);
+            }
+            else if (option.Action == Engine::Action::TRADE)
+            {
+                result = Engine::TRADE(player, story->Trade.first, story->Trade.second);
+            }
+            else if (option.Action == Engine::Action::USE)
+            {
+                result = Engine::USE(player, option.Index);
+            }
+            else
+            {
+                return false;
+            }
+
+            if (result != Engine::Result::OK)
+            {
+                return false;
+            }
+
+            session.Actions++;
+
+            // another action may follow if any are left
+            Engine::ADVANCE(session, Engine::Prompt::NONE);
+
+            return true;
+        }
+        else if (prompt == Engine::Prompt::LOSE_SKILLS)
+        {
+            Engine::LOSE_SKILLS(player, option.Selection);
+        }
+        else if (prompt == Engine::Prompt::TAKE)
+        {
+            Engine::TAKE(player, session.Pending >= 0 ? story->Choices[session.Pending].Items : story->Take, option.Selection, session.Pending >= 0 ? story->Choices[session.Pending].Value : story->Limit);
+        }
+        else if (prompt == Engine::Prompt::LOSE)
+        {
+            Engine::LOSE(player, story->ToLose, option.Selection);
+        }
+        else if (prompt == Engine::Prompt::DROP || prompt == Engine::Prompt::GIVE)
+        {
+            Engine::DROP(player, option.Selection);
+        }
+        else if (prompt == Engine::Prompt::BRIBE)
+        {
+            Engine::BRIBE(player, Choice::TYPES(story->Choices[session.Pending]), option.Selection);
+        }
+
+        // follow-ups of a choice all end with the possessions check
+        Engine::ADVANCE(session, session.Pending >= 0 && prompt != Engine::Prompt::DROP ? Engine::Prompt::NONE : prompt);
+
+        return true;
+    }
+
+    // short description of an option, for logs and command line tools
+    std::string DESCRIBE(Engine::Session &session, const Engine::Option &option)
+    {
+        auto story = session.Section;
+
+        auto description = std::string();
+
+        if (option.Type == Engine::Prompt::CHOICE)
+        {
+            description = story->Choices[option.Index].Text ? story->Choices[option.Index].Text : "(Choice)";
+        }
+        else if (option.Type == Engine::Prompt::ACTION)
+        {
+            if (option.Action == Engine::Action::NEXT)
+            {
+                description = "Next";
+            }
+            else if (option.Action == Engine::Action::BUY)
+            {
+                description = "Buy " + std::string(story->Shop[option.Index].first.Name());
+            }
+            else if (option.Action == Engine::Action::SELL)
+            {
+                description = "Sell " + std::string(story->Sell[option.Index].first.Name());
+            }
+            else if (option.Action == Engine::Action::TRADE)
+            {
+                description = "Trade " + std::string(story->Trade.first.Name()) + " for " + std::string(story->Trade.second.Name());
+            }
+            else if (option.Action == Engine::Action::USE)
+            {
+                description = "Use " + std::string(session.Player.Items[option.Index].Name());
+            }
+        }
+        else
+        {
+            description = std::string(Engine::Prompts[(int)option.Type]) + ":";
+
+            if (option.Selection.size() == 0)
+            {
+                description += " (None)";
+            }
+
+            for (auto i = 0; i < option.Selection.size(); i++)
+            {
+                auto index = option.Selection[i];
+
+                if (option.Type == Engine::Prompt::LOSE_SKILLS)
+                {
+                    description += std::string(i > 0 ? ", " : " ") + session.Player.Skills[index].Name;
+                }
+                else
+                {
+                    auto least = 0;
+
+                    auto most = 0;
+
+                    auto &items = Engine::PILE(session, least, most);
+
+                    description += std::string(i > 0 ? ", " : " ") + items[index].Name();
+                }
+            }
+        }
+
+        return description;
+    }
+} // namespace Engine
+
+#endif
@@ -0,0 +1,493 @@
+#ifndef __EXPLORER__HPP__
+#define __EXPLORER__HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "binary.hpp"
+#include "character.hpp"
+#include "engine.hpp"
+#include "transposition.hpp"
+#include "zobrist.hpp"
+
+// Exhaustive search over every way a game can be played from a starting character
+namespace Explorer
+{
+    // a section waiting to be entered, with the character as it arrives there
+    class Task
+    {
+    public:
+        int Section = 0;
+
+        // sections travelled from the start
+        int Depth = 0;
+
+        Character::Base Player = Character::Base();
+
+        Task()
+        {
+        }
+
+        Task(int section, int depth, Character::Base &player) : Section(section), Depth(depth), Player(player)
+        {
+        }
+    };
+
+    // the character hash is order-independent, so states that differ only in the order of skills, items or codewords share a key
+    std::uint64_t KEY(int section, Character::Base &player)
+    {
+        return Zobrist::SECTION(section) + player.Hash;
+    }
+
+    // everything KEY hashes written out in full, lists sorted, so that two states pack the same exactly when they are the same
+    std::string STATE(int section, const Character::Base &player)
+    {
+        auto writer = Binary::Writer();
+
+        writer.INT(section);
+
+        writer.INT(player.Life);
+
+        writer.INT(player.Money);
+
+        writer.INT(player.ITEM_LIMIT);
+
+        writer.INT(player.MAX_LIFE_LIMIT);
+
+        writer.INT(player.SKILLS_LIMIT);
+
+        writer.INT((int)player.Ship.Type);
+
+        writer.INT(player.Ship.Stars);
+
+        auto sorted = [&](std::vector<std::uint64_t> values)
+        {
+            std::sort(values.begin(), values.end());
+
+            writer.UNSIGNED(values.size());
+
+            for (auto i = 0; i < values.size(); i++)
+            {
+                writer.UNSIGNED(values[i]);
+            }
+        };
+
+        auto skills = std::vector<std::uint64_t>();
+
+        for (auto i = 0; i < player.Skills.size(); i++)
+        {
+            skills.push_back((std::uint64_t)player.Skills[i].Type);
+        }
+
+        sorted(skills);
+
+        skills.clear();
+
+        for (auto i = 0; i < player.TemporarySkills.size(); i++)
+        {
+            skills.push_back((std::uint64_t)player.TemporarySkills[i].Type);
+        }
+
+        sorted(skills);
+
+        auto items = std::vector<std::uint64_t>();
+
+        for (auto i = 0; i < player.Items.size(); i++)
+        {
+            items.push_back(((std::uint64_t)player.Items[i].Type << 32) | ((std::uint64_t)player.Items[i].Variant << 16) | (std::uint16_t)player.Items[i].Charge);
+        }
+
+        sorted(items);
+
+        auto codewords = std::vector<std::uint64_t>();
+
+        for (auto i = 0; i < player.Codewords.size(); i++)
+        {
+            codewords.push_back((std::uint64_t)player.Codewords[i]);
+        }
+
+        sorted(codewords);
+
+        return writer.Bytes;
+    }
+
+    // visited states, split into independently locked shards so workers rarely wait on each other
+    class Visited
+    {
+    public:
+        static const int Shards = 64;
+
+        std::mutex Locks[Shards];
+
+        // the packed state is kept with its key, a key alone would let a colliding state take another's place unnoticed
+        std::unordered_map<std::uint64_t, std::string> Sets[Shards];
+
+        // states whose key was already taken by a different state
+        std::unordered_set<std::string> Collided[Shards];
+
+        std::atomic<long long> Size = {0};
+
+        std::atomic<long long> Collisions = {0};
+
+        // true if the state had not been seen before
+        bool INSERT(std::uint64_t key, std::string &&state)
+        {
+            auto shard = (key >> 58) % Shards;
+
+            std::lock_guard<std::mutex> lock(Locks[shard]);
+
+            auto found = Sets[shard].find(key);
+
+            auto inserted = false;
+
+            if (found == Sets[shard].end())
+            {
+                inserted = Sets[shard].emplace(key, std::move(state)).second;
+            }
+            else if (found->second != state)
+            {
+                inserted = Collided[shard].insert(std::move(state)).second;
+
+                if (inserted)
+                {
+                    Collisions++;
+                }
+            }
+
+            if (inserted)
+            {
+                Size++;
+            }
+
+            return inserted;
+        }
+    };
+
+    // tasks owned by one worker: it works from the back, idle workers steal from the front
+    class Queue
+    {
+    public:
+        std::mutex Lock;
+
+        std::deque<Explorer::Task> Tasks;
+
+        void PUSH(Explorer::Task &&task)
+        {
+            std::lock_guard<std::mutex> lock(Lock);
+
+            Tasks.push_back(std::move(task));
+        }
+
+        bool POP(Explorer::Task &task)
+        {
+            std::lock_guard<std::mutex> lock(Lock);
+
+            if (Tasks.empty())
+            {
+                return false;
+            }
+
+            task = std::move(Tasks.back());
+
+            Tasks.pop_back();
+
+            return true;
+        }
+
+        bool STEAL(Explorer::Task &task)
+        {
+            std::lock_guard<std::mutex> lock(Lock);
+
+            if (Tasks.empty())
+            {
+                return false;
+            }
+
+            task = std::move(Tasks.front());
+
+            Tasks.pop_front();
+
+            return true;
+        }
+    };
+
+    class Report
+    {
+    public:
+        // distinct (section, character) states entered
+        long long States = 0;
+
+        // option sequences tried within sections
+        long long Steps = 0;
+
+        // times each kind of ending was reached, indexed by Engine::Ending
+        std::vector<long long> Endings = std::vector<long long>((int)Engine::Ending::Last + 1, 0);
+
+        // every (section, ending) pair that can be reached
+        std::set<std::pair<int, int>> Reached = std::set<std::pair<int, int>>();
+
+        // sections entered at least once
+        std::set<int> Sections = std::set<int>();
+
+        // the state limit was hit, or the action limit kept a shop, trade or potion from being used again
+        bool Truncated = false;
+
+        // distinct states that shared a key with another, all of them explored
+        long long Collisions = 0;
+
+        // fraction of submitted states answered by the transposition table
+        double HitRate = 0.0;
+
+        void MERGE(const Explorer::Report &other)
+        {
+            States += other.States;
+
+            Steps += other.Steps;
+
+            for (auto i = 0; i < Endings.size(); i++)
+            {
+                Endings[i] += other.Endings[i];
+            }
+
+            Reached.insert(other.Reached.begin(), other.Reached.end());
+
+            Sections.insert(other.Sections.begin(), other.Sections.end());
+
+            Truncated |= other.Truncated;
+        }
+    };
+
+    class Search
+    {
+    public:
+        int Threads = 1;
+
+        // stop adding states past this many, 0 for no limit
+        long long StateLimit = 0;
+
+        // optional shop, trade and use actions considered per section, -1 for as many as money and stock allow
+        int ActionLimit = -1;
+
+        // decisions within one section before it is considered a loop
+        int DepthLimit = 64;
+
+        Explorer::Visited Visited;
+
+        // lock-free cache in front of the visited set, most repeated states are turned away here
+        Transposition::Table Table = Transposition::Table(20);
+
+        std::vector<Explorer::Queue> Queues;
+
+        // tasks queued or in progress
+        std::atomic<long long> Pending = {0};
+
+        Search(int threads) : Threads(std::max(1, threads)), Queues(std::max(1, threads))
+        {
+        }
+    };
+
+    void SUBMIT(Explorer::Search &search, Explorer::Report &report, int worker, int section, int depth, Character::Base &player)
+    {
+        auto key = Explorer::KEY(section, player);
+
+        auto state = Explorer::STATE(section, player);
+
+        // the table holds a checksum of the state beside the key, only a state matching both is turned away here
+        auto check = (int)Binary::CRC32((const std::uint8_t *)state.data(), state.size());
+
+        auto value = 0;
+
+        auto stored = 0;
+
+        if (search.Table.PROBE(key, value, stored) && value == check)
+        {
+            return;
+        }
+
+        if (search.StateLimit > 0 && search.Visited.Size >= search.StateLimit)
+        {
+            report.Truncated = true;
+
+            return;
+        }
+
+        search.Table.STORE(key, check, depth);
+
+        if (search.Visited.INSERT(key, std::move(state)))
+        {
+            search.Pending++;
+
+            search.Queues[worker].PUSH(Explorer::Task(section, depth, player));
+        }
+    }
+
+    // tries every answer to every prompt until the game leaves the section or ends, seen holds the characters the section
+    // has already offered its shop to, as buying or selling the same things in another order leads to the same character
+    void EXPAND(Explorer::Search &search, Explorer::Report &report, int worker, Engine::Session &session, int travelled, int depth, std::unordered_set<std::string> &seen)
+    {
+        report.Steps++;
+
+        if (search.ActionLimit >= 0 && session.Actions >= search.ActionLimit && session.Prompt != Engine::Prompt::END && Engine::OFFERS_ACTIONS(session))
+        {
+            report.Truncated = true;
+        }
+
+        if (session.Prompt == Engine::Prompt::ACTION)
+        {
+            // under a limit the same character with fewer actions left is somewhere else
+            auto state = Explorer::STATE(session.Section->ID, session.Player) + (search.ActionLimit < 0 ? std::string() : std::to_string(session.Actions));
+
+            if (!seen.insert(std::move(state)).second)
+            {
+                return;
+            }
+        }
+
+        if (session.Prompt == Engine::Prompt::END)
+        {
+            report.Endings[(int)session.Ending]++;
+
+            report.Reached.insert({session.Section->ID, (int)session.Ending});
+        }
+        else if (session.Prompt == Engine::Prompt::NONE)
+        {
+            Explorer::SUBMIT(search, report, worker, session.Next, travelled + 1, session.Player);
+        }
+        else if (depth >= search.DepthLimit)
+        {
+            report.Endings[(int)Engine::Ending::LOOP]++;
+
+            report.Reached.insert({session.Section->ID, (int)Engine::Ending::LOOP});
+        }
+        else
+        {
+            auto options = Engine::OPTIONS(session);
+
+            for (auto i = 0; i < options.size(); i++)
+            {
+                auto next = session;
+
+                if (Engine::APPLY(next, options[i]))
+                {
+                    Explorer::EXPAND(search, report, worker, next, travelled, depth + 1, seen);
+                }
+            }
+        }
+    }
+
+    void RUN(Explorer::Search &search, Explorer::Report &report, int worker)
+    {
+        auto task = Explorer::Task();
+
+        auto session = Engine::Session();
+
+        session.Hold = true;
+
+        session.ActionLimit = search.ActionLimit;
+
+        auto seen = std::unordered_set<std::string>();
+
+        while (true)
+        {
+            auto found = search.Queues[worker].POP(task);
+
+            for (auto i = 1; !found && i < search.Threads; i++)
+            {
+                found = search.Queues[(worker + i) % search.Threads].STEAL(task);
+            }
+
+            if (!found)
+            {
+                if (search.Pending == 0)
+                {
+                    break;
+                }
+
+                std::this_thread::yield();
+
+                continue;
+            }
+
+            report.States++;
+
+            report.Sections.insert(task.Section);
+
+            session.Player = task.Player;
+
+            Engine::RESUME(session, task.Section);
+
+            seen.clear();
+
+            Explorer::EXPAND(search, report, worker, session, task.Depth, 0, seen);
+
+            search.Pending--;
+        }
+    }
+
+    // progress, if given, hears the states found and the states still queued every few seconds until the search is done
+    Explorer::Report EXPLORE(Character::Base player, int section, int threads, long long limit, int actions, std::function<void(long long, long long)> progress = nullptr)
+    {
+        auto search = Explorer::Search(threads);
+
+        search.StateLimit = limit;
+
+        search.ActionLimit = actions;
+
+        auto reports = std::vector<Explorer::Report>(search.Threads);
+
+        Explorer::SUBMIT(search, reports[0], 0, section, 0, player);
+
+        auto workers = std::vector<std::thread>();
+
+        for (auto i = 0; i < search.Threads; i++)
+        {
+            workers.push_back(std::thread(Explorer::RUN, std::ref(search), std::ref(reports[i]), i));
+        }
+
+        auto reported = std::chrono::steady_clock::now();
+
+        while (progress && search.Pending > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+            if (std::chrono::steady_clock::now() - reported >= std::chrono::seconds(5))
+            {
+                progress(search.Visited.Size, search.Pending);
+
+                reported = std::chrono::steady_clock::now();
+            }
+        }
+
+        for (auto i = 0; i < workers.size(); i++)
+        {
+            workers[i].join();
+        }
+
+        auto report = Explorer::Report();
+
+        for (auto i = 0; i < reports.size(); i++)
+        {
+            report.MERGE(reports[i]);
+        }
+
+        report.Collisions = search.Visited.Collisions;
+
+        report.HitRate = search.Table.HIT_RATE();
+
+        return report;
+    }
+} // namespace Explorer
+
+#endif
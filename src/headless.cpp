@@ -0,0 +1,6 @@
+#include "core.hpp"
+
+int main(int argc, char **argv)
+{
+    return Core::RUN(argc, argv);
+}
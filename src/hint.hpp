@@ -0,0 +1,450 @@
+#ifndef __HINT__HPP__
+#define __HINT__HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "character.hpp"
+#include "engine.hpp"
+#include "transposition.hpp"
+#include "zobrist.hpp"
+
+// Looks ahead from the current state for the winning line that keeps the most life, without holding up the caller
+namespace Hint
+{
+    // horizon of a value that no depth limit cut short
+    const int UNBOUNDED = 0xFFFF;
+
+    class Result
+    {
+    public:
+        // section the hint applies to, -1 while nothing is known yet
+        int Section = -1;
+
+        // choice to take in that section, -1 when the best line leaves it without one
+        int Choice = -1;
+
+        // life left at the end of the best winning line, -1 if none was found
+        int Life = -1;
+
+        // everything reachable was searched, so a Life of -1 means the game can no longer be won
+        bool Proven = false;
+
+        // sections looked ahead by the last finished pass
+        int Horizon = 0;
+
+        long long States = 0;
+    };
+
+    // best outcome found from a state
+    class Value
+    {
+    public:
+        int Life = -1;
+
+        int Choice = -1;
+
+        // some line was cut short by the horizon
+        bool Cut = false;
+
+        // shallowest position on the current path of a repeated state the value depends on
+        int Cycle = Hint::UNBOUNDED;
+
+        void MERGE(const Hint::Value &other, int choice)
+        {
+            if (other.Life > Life)
+            {
+                Life = other.Life;
+
+                Choice = choice;
+            }
+
+            Cut |= other.Cut;
+
+            Cycle = std::min(Cycle, other.Cycle);
+        }
+    };
+
+    // a way out of a section, with the choice in that section that led to it
+    class Exit
+    {
+    public:
+        int Section = 0;
+
+        int Choice = -1;
+
+        Character::Base Player = Character::Base();
+
+        Exit(int section, int choice, Character::Base &player) : Section(section), Choice(choice), Player(player)
+        {
+        }
+    };
+
+    class Search
+    {
+    public:
+        // shared between requests so that later searches start from what earlier ones proved
+        Transposition::Table &Table;
+
+        std::atomic<bool> &Cancel;
+
+        std::chrono::steady_clock::time_point Deadline;
+
+        // states on the line being searched, used to cut cycles
+        std::vector<std::uint64_t> Path = std::vector<std::uint64_t>();
+
+        // optional shop, trade and use actions considered per section
+        int ActionLimit = 1;
+
+        // decisions within one section before it is considered a loop
+        int DepthLimit = 64;
+
+        long long States = 0;
+
+        // out of time or cancelled, nothing computed from here on may be trusted
+        bool Stopped = false;
+
+        Search(Transposition::Table &table, std::atomic<bool> &cancel, std::chrono::steady_clock::time_point deadline) : Table(table), Cancel(cancel), Deadline(deadline)
+        {
+        }
+
+        bool EXPIRED()
+        {
+            if (!Stopped && (Cancel || ((States & 255) == 0 && std::chrono::steady_clock::now() >= Deadline)))
+            {
+                Stopped = true;
+            }
+
+            return Stopped;
+        }
+    };
+
+    std::uint64_t KEY(int section, Character::Base &player)
+    {
+        return Zobrist::SECTION(section) + player.Hash;
+    }
+
+    // plays out every answer within a section, noting winning endings and the ways out
+    void EXPAND(Hint::Search &search, Engine::Session &session, int depth, int choice, Hint::Value &value, std::vector<Hint::Exit> &exits)
+    {
+        if (session.Prompt == Engine::Prompt::END)
+        {
+            if (session.Ending == Engine::Ending::GOOD && session.Player.Life > value.Life)
+            {
+                value.Life = session.Player.Life;
+
+                value.Choice = choice;
+            }
+        }
+        else if (session.Prompt == Engine::Prompt::NONE)
+        {
+            exits.push_back(Hint::Exit(session.Next, choice, session.Player));
+        }
+        else if (depth < search.DepthLimit)
+        {
+            auto options = Engine::OPTIONS(session);
+
+            for (auto i = 0; i < options.size(); i++)
+            {
+                auto next = session;
+
+                if (Engine::APPLY(next, options[i]))
+                {
+                    Hint::EXPAND(search, next, depth + 1, (choice < 0 && options[i].Type == Engine::Prompt::CHOICE) ? options[i].Index : choice, value, exits);
+                }
+            }
+        }
+    }
+
+    // best life at a winning ending reachable within horizon sections, the root is never answered from the table since it needs the choice
+    Hint::Value VALUE(Hint::Search &search, int section, Character::Base &player, int horizon, bool root)
+    {
+        auto value = Hint::Value();
+
+        auto key = Hint::KEY(section, player);
+
+        auto life = 0;
+
+        auto depth = 0;
+
+        if (!root && search.Table.PROBE(key, life, depth) && depth >= horizon)
+        {
+            value.Life = life;
+
+            value.Cut = depth != Hint::UNBOUNDED;
+
+            return value;
+        }
+
+        for (auto i = 0; i < search.Path.size(); i++)
+        {
+            if (search.Path[i] == key)
+            {
+                value.Cycle = i;
+
+                return value;
+            }
+        }
+
+        if (horizon <= 0)
+        {
+            value.Cut = true;
+
+            return value;
+        }
+
+        search.States++;
+
+        if (search.EXPIRED())
+        {
+            return value;
+        }
+
+        auto session = Engine::Session();
+
+        session.Hold = true;
+
+        session.ActionLimit = search.ActionLimit;
+
+        session.Player = player;
+
+        Engine::RESUME(session, section);
+
+        // the section's event has to be played out in full before other sections reuse the same story object
+        auto exits = std::vector<Hint::Exit>();
+
+        Hint::EXPAND(search, session, 0, -1, value, exits);
+
+        auto seen = std::unordered_set<std::uint64_t>();
+
+        search.Path.push_back(key);
+
+        for (auto i = 0; i < exits.size() && !search.Stopped; i++)
+        {
+            if (seen.insert(Hint::KEY(exits[i].Section, exits[i].Player)).second)
+            {
+                value.MERGE(Hint::VALUE(search, exits[i].Section, exits[i].Player, horizon - 1, false), exits[i].Choice);
+            }
+        }
+
+        search.Path.pop_back();
+
+        if (!search.Stopped)
+        {
+            // a cycle back to this state adds nothing, so the value stops depending on the path once it is resolved here
+            if (value.Cycle >= search.Path.size())
+            {
+                value.Cycle = Hint::UNBOUNDED;
+            }
+
+            if (value.Cycle == Hint::UNBOUNDED)
+            {
+                search.Table.STORE(key, value.Life, value.Cut ? horizon : Hint::UNBOUNDED);
+            }
+        }
+
+        return value;
+    }
+
+    // runs searches on its own thread, a new request cancels the one in progress
+    class Advisor
+    {
+    public:
+        // time allowed per request
+        std::chrono::milliseconds Budget = std::chrono::milliseconds(2000);
+
+        // furthest lookahead, in sections
+        int HorizonLimit = 256;
+
+        Transposition::Table Table;
+
+        std::mutex Lock;
+
+        std::condition_variable Wake;
+
+        std::atomic<bool> Cancel = {false};
+
+        bool Waiting = false;
+
+        // a search is in progress
+        bool Busy = false;
+
+        bool Quit = false;
+
+        int Section = -1;
+
+        Character::Base Player = Character::Base();
+
+        Hint::Result Latest = Hint::Result();
+
+        std::thread Worker;
+
+        // the table holds 2^bits buckets and never grows
+        Advisor(int bits) : Table(bits)
+        {
+            Worker = std::thread(&Hint::Advisor::RUN, this);
+        }
+
+        ~Advisor()
+        {
+            {
+                std::lock_guard<std::mutex> lock(Lock);
+
+                Quit = true;
+
+                Cancel = true;
+            }
+
+            Wake.notify_one();
+
+            Worker.join();
+        }
+
+        // the player as they enter the section, i.e. what a saved game holds
+        void REQUEST(int section, const Character::Base &player)
+        {
+            {
+                std::lock_guard<std::mutex> lock(Lock);
+
+                Section = section;
+
+                Player = player;
+
+                Waiting = true;
+
+                Cancel = true;
+
+                Latest = Hint::Result();
+            }
+
+            Wake.notify_one();
+        }
+
+        void CANCEL()
+        {
+            std::lock_guard<std::mutex> lock(Lock);
+
+            Waiting = false;
+
+            Cancel = true;
+        }
+
+        Hint::Result POLL()
+        {
+            std::lock_guard<std::mutex> lock(Lock);
+
+            return Latest;
+        }
+
+        // true once the latest request has been searched as far as its budget allows
+        bool DONE()
+        {
+            std::lock_guard<std::mutex> lock(Lock);
+
+            return !Waiting && !Busy;
+        }
+
+        // keeps the result unless a newer request came in meanwhile
+        void PUBLISH(Hint::Result &result)
+        {
+            std::lock_guard<std::mutex> lock(Lock);
+
+            if (!Waiting && !Cancel)
+            {
+                Latest = result;
+            }
+        }
+
+        // deepens the search pass after pass, each pass reuses what the earlier ones stored
+        void SOLVE(int section, Character::Base &player)
+        {
+            auto search = Hint::Search(Table, Cancel, std::chrono::steady_clock::now() + Budget);
+
+            auto result = Hint::Result();
+
+            // background jumps may move the player on before any choice is offered
+            auto entered = player;
+
+            result.Section = Engine::ENTER(entered, Engine::FIND(section))->ID;
+
+            for (auto horizon = 2; horizon <= HorizonLimit && !result.Proven; horizon *= 2)
+            {
+                auto value = Hint::VALUE(search, section, player, horizon, true);
+
+                result.States = search.States;
+
+                if (search.Stopped && value.Life <= result.Life)
+                {
+                    Advisor::PUBLISH(result);
+
+                    break;
+                }
+
+                result.Choice = value.Choice;
+
+                result.Life = value.Life;
+
+                result.Proven = !search.Stopped && !value.Cut;
+
+                result.Horizon = horizon;
+
+                Advisor::PUBLISH(result);
+
+                if (search.Stopped)
+                {
+                    break;
+                }
+            }
+        }
+
+        void RUN()
+        {
+            while (true)
+            {
+                auto section = -1;
+
+                auto player = Character::Base();
+
+                {
+                    std::unique_lock<std::mutex> lock(Lock);
+
+                    Wake.wait(lock, [this]
+                              { return Waiting || Quit; });
+
+                    if (Quit)
+                    {
+                        break;
+                    }
+
+                    section = Section;
+
+                    player = Player;
+
+                    Waiting = false;
+
+                    Busy = true;
+
+                    Cancel = false;
+                }
+
+                Advisor::SOLVE(section, player);
+
+                {
+                    std::lock_guard<std::mutex> lock(Lock);
+
+                    Busy = false;
+                }
+            }
+        }
+    };
+
+} // namespace Hint
+
+#endif
@@ -91,6 +91,11 @@ namespace Input
 
                 continue;
             }
+            else if (result.type == SDL_USEREVENT)
+            {
+                // posted by background work with something new to show, the screen is drawn again
+                break;
+            }
             else if (result.type == SDL_KEYDOWN)
             {
                 if (result.key.keysym.sym == SDLK_PAGEUP)
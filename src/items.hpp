@@ -1,8 +1,13 @@
 #ifndef __ITEMS__HPP__
 #define __ITEMS__HPP__
 
+#include <cstdint>
+#include <string>
+#include <type_traits>
 #include <vector>
 
+#include "smallvector.hpp"
+
 namespace Item
 {
     enum class Type
@@ -44,94 +49,216 @@ namespace Item
         Last = RUSTY_SWORD
     };
 
-    class Base
+    // variants share the rules of their item type but are shown under a different name
+    enum class Variant : std::uint16_t
+    {
+        NONE = 0,
+        COCONUT,
+        RUSTY_SWORD
+    };
+
+    class Entry
     {
     public:
-        std::string Name;
-        std::string Description;
+        Item::Type Type = Item::Type::NONE;
+
+        const char *Name = NULL;
+
+        const char *Description = NULL;
+
+        // the player may only ever carry one of these
+        bool Unique = false;
+    };
+
+    // immutable item catalogue, indexed by Item::Type
+    constexpr Item::Entry Catalogue[] = {
+        {Item::Type::MAGIC_AMULET, "MAGIC AMULET", "MAGIC AMULET"},
+        {Item::Type::MAGIC_WAND, "MAGIC WAND", "MAGIC WAND"},
+        {Item::Type::PISTOL, "PISTOL", "PISTOL"},
+        {Item::Type::SWORD, "SWORD", "SWORD"},
+        {Item::Type::SHARKS_TOOTH_SWORD, "SHARK's TOOTH SWORD", "A blade of hard wood studded with shark's teeth"},
+        {Item::Type::FEATHER_SHIELD, "FEATHER SHIELD", "FEATHER SHIELD"},
+        {Item::Type::CRUCIFIX, "CRUCIFIX", "CRUCIFIX"},
+        {Item::Type::COMPASS, "COMPASS", "COMPASS"},
+        {Item::Type::PARROT, "PARROT", "PARROT"},
+        {Item::Type::THUNDERCLOUD_FAN, "THUNDERCLOUD FAN", "THUNDERCLOUD FAN"},
+        {Item::Type::OBSIDIAN_NECKLACE, "OBSIDIAN NECKLACE", "OBSIDIAN NECKLACE"},
+        {Item::Type::LETTER_OF_MARQUE, "LETTER OF MARQUE", "LETTER OF MARQUE"},
+        {Item::Type::CONCH_SHELL_HORN, "CONCH SHELL HORN", "CONCH SHELL HORN"},
+        {Item::Type::BAT_SHAPED_TALISMAN, "BAT-SHAPED TALISMAN", "BAT-SHAPED TALISMAN"},
+        {Item::Type::BRONZE_HELMET, "BRONZE HELMET", "BRONZE HELMET", true},
+        {Item::Type::DRAGON_RING, "DRAGON RING", "DRAGON RING", true},
+        {Item::Type::TOOLKIT, "TOOLKIT", "TOOLKIT"},
+        {Item::Type::BOOK_OF_CHARTS, "BOOK OF CHARTS", "BOOK OF CHARTS"},
+        {Item::Type::LODESTONE, "LODESTONE", "LODESTONE"},
+        {Item::Type::MONKEY, "MONKEY", "MONKEY"},
+        {Item::Type::SHIP_IN_BOTTLE, "SHIP IN A BOTTLE", "SHIP IN A BOTTLE"},
+        {Item::Type::BLACK_KITE, "BLACK KITE", "BLACK KITE"},
+        {Item::Type::HEALING_POTION, "HEALING POTION", "HEALING POTION"},
+        {Item::Type::DIAMOND, "DIAMOND", "DIAMOND"},
+        {Item::Type::DEED_OF_OWNERSHIP, "DEED OF OWNERSHIP", "DEED OF OWNERSHIP"},
+        {Item::Type::WEASEL, "WEASEL", "WEASEL"},
+        {Item::Type::POCKET_WATCH, "POCKET-WATCH", "POCKET-WATCH"},
+        {Item::Type::CORKSCREW, "CORKSCREW", "CORKSCREW"},
+        {Item::Type::PROVISIONS, "PROVISIONS", "PROVISIONS"},
+        {Item::Type::HORNPIPE, "HORNPIPE", "HORNPIPE"},
+        {Item::Type::CLEAVER, "CLEAVER", "CLEAVER"},
+        {Item::Type::RUSTY_SWORD, "RUSTY SWORD", "RUSTY SWORD"}};
+
+    // indexed by Item::Variant
+    constexpr Item::Entry Variants[] = {
+        {Item::Type::NONE, "NONE", "NONE"},
+        {Item::Type::PROVISIONS, "COCONUT", "COCONUT"},
+        {Item::Type::SWORD, "RUSTY SWORD", "RUSTY SWORD"}};
+
+    constexpr Item::Entry Unknown = {Item::Type::NONE, "UNKNOWN ITEM", "UNKNOWN ITEM"};
+
+    constexpr bool VERIFY_CATALOGUE()
+    {
+        auto count = sizeof(Item::Catalogue) / sizeof(Item::Entry);
+
+        auto verified = count == (int)Item::Type::Last + 1;
+
+        for (auto i = 0; verified && i < count; i++)
+        {
+            verified = Item::Catalogue[i].Type == static_cast<Item::Type>(i) && Item::Catalogue[i].Name != NULL && Item::Catalogue[i].Description != NULL;
+        }
+
+        return verified;
+    }
+
+    static_assert(Item::VERIFY_CATALOGUE(), "every item type needs its own entry in Item::Catalogue, in enum order");
+
+    constexpr bool IsValid(Item::Type item)
+    {
+        return item >= Item::Type::First && item <= Item::Type::Last;
+    }
+
+    constexpr const Item::Entry &LOOKUP(Item::Type type, Item::Variant variant)
+    {
+        if (variant != Item::Variant::NONE && (int)variant < sizeof(Item::Variants) / sizeof(Item::Entry))
+        {
+            return Item::Variants[(int)variant];
+        }
+        else if (Item::IsValid(type))
+        {
+            return Item::Catalogue[(int)type];
+        }
+        else
+        {
+            return Item::Unknown;
+        }
+    }
 
+    // live items only carry their type and charge, names come from the catalogue
+    class Base
+    {
+    public:
         Item::Type Type = Item::Type::NONE;
 
-        int Charge = -1;
+        std::int16_t Charge = -1;
+
+        Item::Variant Variant = Item::Variant::NONE;
+
+        constexpr Base()
+        {
+        }
+
+        constexpr Base(Item::Type type) : Type(type)
+        {
+        }
+
+        constexpr Base(Item::Type type, int charge) : Type(type), Charge(charge)
+        {
+        }
 
-        Base()
+        constexpr Base(Item::Type type, Item::Variant variant) : Type(type), Variant(variant)
         {
         }
 
-        Base(const char *name, const char *description, Item::Type type)
+        constexpr Base(Item::Type type, Item::Variant variant, int charge) : Type(type), Charge(charge), Variant(variant)
         {
-            Name = name;
-            Description = description;
-            Type = type;
         }
 
-        Base(const char *name, const char *description, Item::Type type, int charge)
+        const char *Name() const
         {
-            Name = name;
-            Description = description;
-            Type = type;
-            Charge = charge;
+            return Item::LOOKUP(Type, Variant).Name;
+        }
+
+        const char *Description() const
+        {
+            return Item::LOOKUP(Type, Variant).Description;
         }
     };
 
-    // Item defaults
+    static_assert(sizeof(Item::Base) == 8, "items should stay 8-byte values");
 
-    auto MAGIC_AMULET = Item::Base("MAGIC AMULET", "MAGIC AMULET", Item::Type::MAGIC_AMULET);
-    auto MAGIC_WAND = Item::Base("MAGIC WAND", "MAGIC WAND", Item::Type::MAGIC_WAND);
-    auto PISTOL = Item::Base("PISTOL", "PISTOL", Item::Type::PISTOL);
-    auto SWORD = Item::Base("SWORD", "SWORD", Item::Type::SWORD);
-    auto FEATHER_SHIELD = Item::Base("FEATHER SHIELD", "FEATHER SHIELD", Item::Type::FEATHER_SHIELD);
-    auto CRUCIFIX = Item::Base("CRUCIFIX", "CRUCIFIX", Item::Type::CRUCIFIX);
-    auto COMPASS = Item::Base("COMPASS", "COMPASS", Item::Type::COMPASS);
-    auto PARROT = Item::Base("PARROT", "PARROT", Item::Type::PARROT);
-    auto THUNDERCLOUD_FAN = Item::Base("THUNDERCLOUD FAN", "THUNDERCLOUD FAN", Item::Type::THUNDERCLOUD_FAN);
-    auto OBSIDIAN_NECKLACE = Item::Base("OBSIDIAN NECKLACE", "OBSIDIAN NECKLACE", Item::Type::OBSIDIAN_NECKLACE);
-    auto SHARKS_TOOTH_SWORD = Item::Base("SHARK's TOOTH SWORD", "A blade of hard wood studded with shark's teeth", Item::Type::SHARKS_TOOTH_SWORD);
-    auto LETTER_OF_MARQUE = Item::Base("LETTER OF MARQUE", "LETTER OF MARQUE", Item::Type::LETTER_OF_MARQUE);
-    auto CONCH_SHELL_HORN = Item::Base("CONCH SHELL HORN", "CONCH SHELL HORN", Item::Type::CONCH_SHELL_HORN);
-    auto BAT_SHAPED_TALISMAN = Item::Base("BAT-SHAPED TALISMAN", "BAT-SHAPED TALISMAN", Item::Type::BAT_SHAPED_TALISMAN);
-    auto BRONZE_HELMET = Item::Base("BRONZE HELMET", "BRONZE HELMET", Item::Type::BRONZE_HELMET);
-    auto DRAGON_RING = Item::Base("DRAGON RING", "DRAGON RING", Item::Type::DRAGON_RING);
-    auto TOOLKIT = Item::Base("TOOLKIT", "TOOLKIT", Item::Type::TOOLKIT);
-    auto BOOK_OF_CHARTS = Item::Base("BOOK OF CHARTS", "BOOK OF CHARTS", Item::Type::BOOK_OF_CHARTS);
-    auto LODESTONE = Item::Base("LODESTONE", "LODESTONE", Item::Type::LODESTONE);
-    auto MONKEY = Item::Base("MONKEY", "MONKEY", Item::Type::MONKEY);
-    auto SHIP_IN_BOTTLE = Item::Base("SHIP IN A BOTTLE", "SHIP IN A BOTTLE", Item::Type::SHIP_IN_BOTTLE);
-    auto BLACK_KITE = Item::Base("BLACK KITE", "BLACK KITE", Item::Type::BLACK_KITE);
-    auto DIAMOND = Item::Base("DIAMOND", "DIAMOND", Item::Type::DIAMOND);
-    auto HEALING_POTION = Item::Base("HEALING POTION", "HEALING POTION", Item::Type::HEALING_POTION);
-    auto DEED_OF_OWNERSHIP = Item::Base("DEED OF OWNERSHIP", "DEED OF OWNERSHIP", Item::Type::DEED_OF_OWNERSHIP);
-    auto WEASEL = Item::Base("WEASEL", "WEASEL", Item::Type::WEASEL);
-    auto POCKET_WATCH = Item::Base("POCKET-WATCH", "POCKET-WATCH", Item::Type::POCKET_WATCH);
-    auto CORKSCREW = Item::Base("CORKSCREW", "CORKSCREW", Item::Type::CORKSCREW);
-    auto PROVISIONS = Item::Base("PROVISIONS", "PROVISIONS", Item::Type::PROVISIONS);
-    auto HORNPIPE = Item::Base("HORNPIPE", "HORNPIPE", Item::Type::HORNPIPE);
-    auto COCONUT = Item::Base("COCONUT", "COCONUT", Item::Type::PROVISIONS);
-    auto CLEAVER = Item::Base("CLEAVER", "CLEAVER", Item::Type::CLEAVER);
-    auto RUSTY_SWORD = Item::Base("RUSTY SWORD", "RUSTY SWORD", Item::Type::SWORD);
-
-    std::vector<Item::Type> UniqueItems = {
-        Item::Type::DRAGON_RING,
-        Item::Type::BRONZE_HELMET};
-
-    bool IsUnique(Item::Type item)
+    static_assert(std::is_trivially_copyable<Item::Base>::value, "items should be copied as plain values");
+
+    // finds the variant an item was saved under
+    Item::Variant VARIANT(Item::Type type, std::string name)
     {
-        auto unique = false;
+        auto variant = Item::Variant::NONE;
 
-        for (auto i = 0; i < Item::UniqueItems.size(); i++)
+        for (auto i = 1; i < sizeof(Item::Variants) / sizeof(Item::Entry); i++)
         {
-            if (Item::UniqueItems[i] == item)
+            if (Item::Variants[i].Type == type && name == Item::Variants[i].Name)
             {
-                unique = true;
+                variant = static_cast<Item::Variant>(i);
 
                 break;
             }
         }
 
-        return unique;
+        return variant;
+    }
+
+    // inline capacity covers the default possessions limit
+    typedef SmallVector<Item::Base, 8> List;
+
+    // Item defaults
+
+    auto MAGIC_AMULET = Item::Base(Item::Type::MAGIC_AMULET);
+    auto MAGIC_WAND = Item::Base(Item::Type::MAGIC_WAND);
+    auto PISTOL = Item::Base(Item::Type::PISTOL);
+    auto SWORD = Item::Base(Item::Type::SWORD);
+    auto FEATHER_SHIELD = Item::Base(Item::Type::FEATHER_SHIELD);
+    auto CRUCIFIX = Item::Base(Item::Type::CRUCIFIX);
+    auto COMPASS = Item::Base(Item::Type::COMPASS);
+    auto PARROT = Item::Base(Item::Type::PARROT);
+    auto THUNDERCLOUD_FAN = Item::Base(Item::Type::THUNDERCLOUD_FAN);
+    auto OBSIDIAN_NECKLACE = Item::Base(Item::Type::OBSIDIAN_NECKLACE);
+    auto SHARKS_TOOTH_SWORD = Item::Base(Item::Type::SHARKS_TOOTH_SWORD);
+    auto LETTER_OF_MARQUE = Item::Base(Item::Type::LETTER_OF_MARQUE);
+    auto CONCH_SHELL_HORN = Item::Base(Item::Type::CONCH_SHELL_HORN);
+    auto BAT_SHAPED_TALISMAN = Item::Base(Item::Type::BAT_SHAPED_TALISMAN);
+    auto BRONZE_HELMET = Item::Base(Item::Type::BRONZE_HELMET);
+    auto DRAGON_RING = Item::Base(Item::Type::DRAGON_RING);
+    auto TOOLKIT = Item::Base(Item::Type::TOOLKIT);
+    auto BOOK_OF_CHARTS = Item::Base(Item::Type::BOOK_OF_CHARTS);
+    auto LODESTONE = Item::Base(Item::Type::LODESTONE);
+    auto MONKEY = Item::Base(Item::Type::MONKEY);
+    auto SHIP_IN_BOTTLE = Item::Base(Item::Type::SHIP_IN_BOTTLE);
+    auto BLACK_KITE = Item::Base(Item::Type::BLACK_KITE);
+    auto DIAMOND = Item::Base(Item::Type::DIAMOND);
+    auto HEALING_POTION = Item::Base(Item::Type::HEALING_POTION);
+    auto DEED_OF_OWNERSHIP = Item::Base(Item::Type::DEED_OF_OWNERSHIP);
+    auto WEASEL = Item::Base(Item::Type::WEASEL);
+    auto POCKET_WATCH = Item::Base(Item::Type::POCKET_WATCH);
+    auto CORKSCREW = Item::Base(Item::Type::CORKSCREW);
+    auto PROVISIONS = Item::Base(Item::Type::PROVISIONS);
+    auto HORNPIPE = Item::Base(Item::Type::HORNPIPE);
+    auto COCONUT = Item::Base(Item::Type::PROVISIONS, Item::Variant::COCONUT);
+    auto CLEAVER = Item::Base(Item::Type::CLEAVER);
+    auto RUSTY_SWORD = Item::Base(Item::Type::SWORD, Item::Variant::RUSTY_SWORD);
+
+    constexpr bool IsUnique(Item::Type item)
+    {
+        return Item::IsValid(item) && Item::Catalogue[(int)item].Unique;
     }
 
-    void REMOVE(std::vector<Item::Base> &items, Item::Base item)
+    template <typename T>
+    void REMOVE(T &items, Item::Base item)
     {
         if (items.size() > 0)
         {
@@ -147,7 +274,8 @@ namespace Item
         }
     }
 
-    void ADD(std::vector<Item::Base> &items, Item::Base item)
+    template <typename T>
+    void ADD(T &items, Item::Base item)
     {
         if (items.size() > 0)
         {
@@ -172,7 +300,8 @@ namespace Item
         }
     }
 
-    bool VERIFY(std::vector<Item::Base> &items, Item::Base item)
+    template <typename T>
+    bool VERIFY(T &items, Item::Base item)
     {
         auto has = false;
 
@@ -209,7 +338,8 @@ namespace Item
         return found;
     }
 
-    int FIND_TYPE(std::vector<Item::Base> list, Item::Type item)
+    template <typename T>
+    int FIND_TYPE(T &list, Item::Type item)
     {
         auto found = -1;
 
@@ -226,7 +356,8 @@ namespace Item
         return found;
     }
 
-    int COUNT_TYPES(std::vector<Item::Base> &list, Item::Type item)
+    template <typename T>
+    int COUNT_TYPES(T &list, Item::Type item)
     {
         auto found = 0;
 
@@ -241,7 +372,8 @@ namespace Item
         return found;
     }
 
-    int FIND_LEAST(std::vector<Item::Base> &list, Item::Type item)
+    template <typename T>
+    int FIND_LEAST(T &list, Item::Type item)
     {
         auto found = -1;
 
@@ -0,0 +1,463 @@
+#ifndef __JOURNAL__HPP__
+#define __JOURNAL__HPP__
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "binary.hpp"
+#include "character.hpp"
+#include "engine.hpp"
+#include "mutation.hpp"
+
+// Append-only record of everything the player decided in a session, precise enough to play the session again
+namespace Journal
+{
+    enum class Record : std::uint8_t
+    {
+        START = 0,
+        ENTER,
+        CHOICE,
+        DESTINATION,
+        CONTINUE,
+        TAKE,
+        LOSE,
+        DROP,
+        BRIBE,
+        LOSE_SKILLS,
+        BUY,
+        SELL,
+        TRADE,
+        USE,
+        First = START,
+        Last = USE
+    };
+
+    constexpr const char *Records[] = {"START", "ENTER", "CHOICE", "DESTINATION", "CONTINUE", "TAKE", "LOSE", "DROP", "BRIBE", "LOSE_SKILLS", "BUY", "SELL", "TRADE", "USE"};
+
+    static_assert(sizeof(Journal::Records) / sizeof(const char *) == (int)Journal::Record::Last + 1, "every record needs its own entry in Journal::Records, in enum order");
+
+    const char MAGIC[] = "DMJ";
+
+    const int VERSION = 1;
+
+    // records go to a stdio buffer and reach the disk once per section, so writing one costs no more than a memcpy
+    class Writer
+    {
+    public:
+        std::FILE *File = NULL;
+
+        Binary::Writer Buffer = Binary::Writer();
+
+        Writer()
+        {
+        }
+
+        ~Writer()
+        {
+            CLOSE();
+        }
+
+        bool OPEN(const std::string &file_name)
+        {
+            CLOSE();
+
+            File = std::fopen(file_name.c_str(), "ab");
+
+            if (File)
+            {
+                std::setvbuf(File, NULL, _IOFBF, 1 << 16);
+
+                if (std::ftell(File) == 0)
+                {
+                    std::fwrite(Journal::MAGIC, 1, sizeof(Journal::MAGIC) - 1, File);
+
+                    std::fputc(Journal::VERSION, File);
+                }
+            }
+
+            return File != NULL;
+        }
+
+        void CLOSE()
+        {
+            if (File)
+            {
+                std::fclose(File);
+
+                File = NULL;
+            }
+        }
+
+        // hands the encoded record to stdio
+        void COMMIT(bool flush)
+        {
+            if (File)
+            {
+                std::fwrite(Buffer.Bytes.data(), 1, Buffer.Bytes.size(), File);
+
+                if (flush)
+                {
+                    std::fflush(File);
+                }
+            }
+
+            Buffer.Bytes.clear();
+        }
+
+        void START(const Character::Base &player, int story)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::START);
+            Buffer.CHARACTER(player);
+            Buffer.INT(story);
+
+            COMMIT(true);
+        }
+
+        // section requested and section reached after background jumps
+        void ENTER(int from, int to)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::ENTER);
+            Buffer.INT(from);
+            Buffer.INT(to);
+
+            COMMIT(true);
+        }
+
+        void CHOICE(int choice)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::CHOICE);
+            Buffer.INT(choice);
+
+            COMMIT(false);
+        }
+
+        void DESTINATION(int section)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::DESTINATION);
+            Buffer.INT(section);
+
+            COMMIT(false);
+        }
+
+        void CONTINUE(int section)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::CONTINUE);
+            Buffer.INT(section);
+
+            COMMIT(false);
+        }
+
+        // the items actually taken
+        void TAKE(const Item::List &items)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::TAKE);
+            Buffer.ITEMS(items);
+
+            COMMIT(false);
+        }
+
+        void LOSE(const Item::List &items)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::LOSE);
+            Buffer.ITEMS(items);
+
+            COMMIT(false);
+        }
+
+        void DROP(const Engine::Selection &selection)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::DROP);
+            Buffer.VALUES(selection);
+
+            COMMIT(false);
+        }
+
+        void BRIBE(const std::vector<Item::Type> &types, const Engine::Selection &selection)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::BRIBE);
+            Buffer.VALUES(types);
+            Buffer.VALUES(selection);
+
+            COMMIT(false);
+        }
+
+        void LOSE_SKILLS(const std::vector<Skill::Type> &skills)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::LOSE_SKILLS);
+            Buffer.VALUES(skills);
+
+            COMMIT(false);
+        }
+
+        void BUY(const Item::Base &item, int price)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::BUY);
+            Buffer.ITEM(item);
+            Buffer.INT(price);
+
+            COMMIT(false);
+        }
+
+        void SELL(const Item::Base &item, int price)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::SELL);
+            Buffer.ITEM(item);
+            Buffer.INT(price);
+
+            COMMIT(false);
+        }
+
+        void TRADE(const Item::Base &mine, const Item::Base &theirs)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::TRADE);
+            Buffer.ITEM(mine);
+            Buffer.ITEM(theirs);
+
+            COMMIT(false);
+        }
+
+        void USE(int index)
+        {
+            Buffer.BYTE((std::uint8_t)Journal::Record::USE);
+            Buffer.INT(index);
+
+            COMMIT(false);
+        }
+    };
+
+    class Replay
+    {
+    public:
+        long long Records = 0;
+
+        long long Sections = 0;
+
+        Character::Base Player = Character::Base();
+
+        Story::Base *Section = NULL;
+
+        // the player and section at the last ENTER, where a game can be picked up again
+        Character::Base Checkpoint = Character::Base();
+
+        int CheckpointSection = -1;
+
+        // every change the replay made to the player, committed at each section entered
+        Mutation::Log Mutations = Mutation::Log();
+
+        // set when the journal cannot be read or the game no longer plays out the way it was recorded
+        std::string Error = std::string();
+    };
+
+    std::string READ(const std::string &file_name)
+    {
+        std::ifstream ifs(file_name, std::ios::binary);
+
+        return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+
+    // replays each record against the rules, checking every section reached against the one recorded
+    Journal::Replay REPLAY(const std::string &bytes)
+    {
+        auto replay = Journal::Replay();
+
+        auto header = sizeof(Journal::MAGIC) - 1;
+
+        if (bytes.size() < header + 1 || bytes.compare(0, header, Journal::MAGIC) != 0 || bytes[header] != Journal::VERSION)
+        {
+            replay.Error = "not a journal";
+
+            return replay;
+        }
+
+        auto reader = Binary::Reader((const std::uint8_t *)bytes.data() + header + 1, bytes.size() - header - 1);
+
+        auto &player = replay.Player;
+
+        player.Mutations.Log = &replay.Mutations;
+
+        auto chosen = -1;
+
+        auto expect = [&](int recorded, int actual, const char *what)
+        {
+            if (recorded != actual)
+            {
+                replay.Error = std::string(what) + " " + std::to_string(actual) + " where the journal has " + std::to_string(recorded);
+            }
+        };
+
+        while (!reader.END() && replay.Error.empty())
+        {
+            auto record = static_cast<Journal::Record>(reader.BYTE());
+
+            if (record != Journal::Record::START && replay.Section == NULL)
+            {
+                replay.Error = "journal does not begin with a starting character";
+
+                break;
+            }
+
+            if (record == Journal::Record::START)
+            {
+                player = reader.CHARACTER();
+
+                replay.Mutations.CLEAR();
+
+                replay.Section = Engine::FIND((int)reader.INT());
+            }
+            else if (record == Journal::Record::ENTER)
+            {
+                auto from = (int)reader.INT();
+
+                auto to = (int)reader.INT();
+
+                expect(from, replay.Section->ID, "entered");
+
+                replay.Checkpoint = player;
+
+                replay.CheckpointSection = replay.Section->ID;
+
+                replay.Mutations.COMMIT();
+
+                replay.Section = Engine::ENTER(player, replay.Section);
+
+                replay.Sections++;
+
+                expect(to, replay.Section->ID, "landed in");
+            }
+            else if (record == Journal::Record::CHOICE)
+            {
+                chosen = (int)reader.INT();
+
+                if (chosen >= 0 && chosen < replay.Section->Choices.size())
+                {
+                    Choice::APPLY(player, replay.Section->Choices[chosen]);
+                }
+                else
+                {
+                    replay.Error = "choice " + std::to_string(chosen) + " does not exist in " + std::to_string(replay.Section->ID);
+                }
+            }
+            else if (record == Journal::Record::DESTINATION)
+            {
+                auto to = (int)reader.INT();
+
+                if (chosen >= 0 && chosen < replay.Section->Choices.size())
+                {
+                    replay.Section = Engine::DESTINATION(player, replay.Section, replay.Section->Choices[chosen]);
+
+                    expect(to, replay.Section->ID, "choice led to");
+                }
+                else
+                {
+                    replay.Error = "destination without a choice";
+                }
+
+                chosen = -1;
+            }
+            else if (record == Journal::Record::CONTINUE)
+            {
+                auto to = (int)reader.INT();
+
+                replay.Section = Engine::FIND(replay.Section->Continue(player));
+
+                expect(to, replay.Section->ID, "continued to");
+            }
+            else if (record == Journal::Record::TAKE)
+            {
+                auto items = reader.ITEMS();
+
+                Character::GET_ITEMS(player, items);
+            }
+            else if (record == Journal::Record::LOSE)
+            {
+                auto items = reader.ITEMS();
+
+                for (auto i = 0; i < items.size(); i++)
+                {
+                    Character::LOSE_ITEMS(player, {items[i].Type});
+                }
+            }
+            else if (record == Journal::Record::DROP)
+            {
+                auto selection = reader.VALUES();
+
+                Engine::DROP(player, Engine::Selection(selection));
+            }
+            else if (record == Journal::Record::BRIBE)
+            {
+                auto values = reader.VALUES();
+
+                auto selection = reader.VALUES();
+
+                auto types = std::vector<Item::Type>();
+
+                for (auto i = 0; i < values.size(); i++)
+                {
+                    types.push_back(static_cast<Item::Type>(values[i]));
+                }
+
+                Engine::BRIBE(player, types, Engine::Selection(selection));
+            }
+            else if (record == Journal::Record::LOSE_SKILLS)
+            {
+                auto values = reader.VALUES();
+
+                auto skills = std::vector<Skill::Type>();
+
+                for (auto i = 0; i < values.size(); i++)
+                {
+                    skills.push_back(static_cast<Skill::Type>(values[i]));
+                }
+
+                Character::LOSE_SKILLS(player, skills);
+            }
+            else if (record == Journal::Record::BUY)
+            {
+                auto item = reader.ITEM();
+
+                Engine::BUY(player, item, (int)reader.INT());
+            }
+            else if (record == Journal::Record::SELL)
+            {
+                auto item = reader.ITEM();
+
+                Engine::SELL(player, item, (int)reader.INT());
+            }
+            else if (record == Journal::Record::TRADE)
+            {
+                auto mine = reader.ITEM();
+
+                auto theirs = reader.ITEM();
+
+                Engine::TRADE(player, mine, theirs);
+            }
+            else if (record == Journal::Record::USE)
+            {
+                Engine::USE(player, (int)reader.INT());
+            }
+            else
+            {
+                replay.Error = "unknown record " + std::to_string((int)record);
+            }
+
+            if (!reader.Good && replay.Error.empty())
+            {
+                replay.Error = std::string("truncated ") + ((record >= Journal::Record::First && record <= Journal::Record::Last) ? Journal::Records[(int)record] : "record");
+            }
+
+            if (replay.Error.empty())
+            {
+                replay.Records++;
+            }
+        }
+
+        return replay;
+    }
+
+} // namespace Journal
+
+#endif
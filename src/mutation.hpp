@@ -0,0 +1,178 @@
+#ifndef __MUTATION__HPP__
+#define __MUTATION__HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "items.hpp"
+
+// Typed record of every change made to a character, each one carrying enough to be applied again or undone
+namespace Mutation
+{
+    enum class Type : std::uint8_t
+    {
+        LIFE = 0,
+        LIFE_LIMIT,
+        MONEY,
+        LOST_MONEY,
+        SKILLS_LIMIT,
+        SHIP,
+        STARS,
+        CHARGE,
+        ADD_ITEM,
+        REMOVE_ITEM,
+        ADD_LOST_ITEM,
+        REMOVE_LOST_ITEM,
+        ADD_SKILL,
+        REMOVE_SKILL,
+        ADD_LOST_SKILL,
+        REMOVE_LOST_SKILL,
+        ADD_TEMPORARY_SKILL,
+        REMOVE_TEMPORARY_SKILL,
+        ADD_CODEWORD,
+        REMOVE_CODEWORD,
+        First = LIFE,
+        Last = REMOVE_CODEWORD
+    };
+
+    constexpr const char *Names[] = {"LIFE", "LIFE_LIMIT", "MONEY", "LOST_MONEY", "SKILLS_LIMIT", "SHIP", "STARS", "CHARGE", "ADD_ITEM", "REMOVE_ITEM", "ADD_LOST_ITEM", "REMOVE_LOST_ITEM", "ADD_SKILL", "REMOVE_SKILL", "ADD_LOST_SKILL", "REMOVE_LOST_SKILL", "ADD_TEMPORARY_SKILL", "REMOVE_TEMPORARY_SKILL", "ADD_CODEWORD", "REMOVE_CODEWORD"};
+
+    static_assert(sizeof(Mutation::Names) / sizeof(const char *) == (int)Mutation::Type::Last + 1, "every mutation needs its own entry in Mutation::Names, in enum order");
+
+    // values change from Before to After, list changes add or remove After (or Item) at position Index
+    class Record
+    {
+    public:
+        Mutation::Type Type = Mutation::Type::LIFE;
+
+        int Index = -1;
+
+        int Before = 0;
+
+        int After = 0;
+
+        Item::Base Item = Item::Base();
+
+        Record()
+        {
+        }
+
+        Record(Mutation::Type type, int before, int after) : Type(type), Before(before), After(after)
+        {
+        }
+
+        Record(Mutation::Type type, int index, int before, int after) : Type(type), Index(index), Before(before), After(after)
+        {
+        }
+
+        Record(Mutation::Type type, int index, const Item::Base &item) : Type(type), Index(index), Item(item)
+        {
+        }
+    };
+
+    // additions and removals come in pairs, ADD_ first
+    constexpr bool IsList(Mutation::Type type)
+    {
+        return type >= Mutation::Type::ADD_ITEM;
+    }
+
+    // the record that undoes this one
+    Mutation::Record INVERSE(Mutation::Record record)
+    {
+        if (Mutation::IsList(record.Type))
+        {
+            auto offset = (int)record.Type - (int)Mutation::Type::ADD_ITEM;
+
+            record.Type = static_cast<Mutation::Type>((int)Mutation::Type::ADD_ITEM + (offset ^ 1));
+        }
+        else
+        {
+            auto before = record.Before;
+
+            record.Before = record.After;
+
+            record.After = before;
+        }
+
+        return record;
+    }
+
+    // append-only, records are only ever dropped from the end when they are reverted
+    class Log
+    {
+    public:
+        std::vector<Mutation::Record> Records = std::vector<Mutation::Record>();
+
+        // size of Records at the end of each committed section
+        std::vector<std::size_t> Commits = std::vector<std::size_t>();
+
+        // mutations recorded over the lifetime of the log, per Mutation::Type
+        std::vector<long long> Counts = std::vector<long long>((int)Mutation::Type::Last + 1, 0);
+
+        void RECORD(const Mutation::Record &record)
+        {
+            Records.push_back(record);
+
+            Counts[(int)record.Type]++;
+        }
+
+        void COMMIT()
+        {
+            if (Commits.empty() || Commits.back() != Records.size())
+            {
+                Commits.push_back(Records.size());
+            }
+        }
+
+        // where the records of the section that many commits back begin, 0 if that is further back than the log goes
+        std::size_t MARK(int sections)
+        {
+            return (sections >= 0 && sections < Commits.size()) ? Commits[Commits.size() - 1 - sections] : 0;
+        }
+
+        // forgets the records from mark on, they must have been reverted already
+        void TRUNCATE(std::size_t mark)
+        {
+            if (mark < Records.size())
+            {
+                Records.resize(mark);
+            }
+
+            while (!Commits.empty() && Commits.back() > mark)
+            {
+                Commits.pop_back();
+            }
+        }
+
+        void CLEAR()
+        {
+            Records.clear();
+
+            Commits.clear();
+        }
+    };
+
+    // the log a character writes to, copies of the character start without one and assignment keeps the one already attached
+    class Tap
+    {
+    public:
+        Mutation::Log *Log = NULL;
+
+        Tap()
+        {
+        }
+
+        Tap(const Mutation::Tap &)
+        {
+        }
+
+        Mutation::Tap &operator=(const Mutation::Tap &)
+        {
+            return *this;
+        }
+    };
+
+} // namespace Mutation
+
+#endif
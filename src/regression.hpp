@@ -0,0 +1,287 @@
+#ifndef __REGRESSION__HPP__
+#define __REGRESSION__HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "character.hpp"
+#include "engine.hpp"
+#include "storygraph.hpp"
+#include "zobrist.hpp"
+
+// Every section entered by every kind of character, checking the rules hold however the player got there
+namespace Regression
+{
+    // a character to enter sections with
+    class Archetype
+    {
+    public:
+        std::string Name = std::string();
+
+        Character::Base Player = Character::Base();
+
+        Archetype(std::string name, Character::Base player) : Name(name), Player(player)
+        {
+        }
+    };
+
+    class Failure
+    {
+    public:
+        int Section = 0;
+
+        std::string Archetype = std::string();
+
+        std::string What = std::string();
+
+        Failure(int section, std::string archetype, std::string what) : Section(section), Archetype(archetype), What(what)
+        {
+        }
+    };
+
+    class Report
+    {
+    public:
+        // sections entered, one per section and archetype
+        long long Cases = 0;
+
+        std::vector<Regression::Failure> Failures = std::vector<Regression::Failure>();
+
+        void MERGE(const Regression::Report &other)
+        {
+            Cases += other.Cases;
+
+            Failures.insert(Failures.end(), other.Failures.begin(), other.Failures.end());
+        }
+    };
+
+    // the predefined classes and a few characters at the edges of what the rules allow
+    std::vector<Regression::Archetype> ARCHETYPES()
+    {
+        auto archetypes = std::vector<Regression::Archetype>();
+
+        for (auto i = 0; i < Character::Archetypes.size(); i++)
+        {
+            archetypes.push_back(Regression::Archetype(Character::Archetypes[i].Name, Character::Archetypes[i]));
+        }
+
+        auto frail = Character::ADVENTURER;
+
+        Character::SET_LIFE(frail, 1);
+
+        archetypes.push_back(Regression::Archetype("1 Life", frail));
+
+        auto broke = Character::BUCCANEER;
+
+        Character::GAIN_MONEY(broke, -broke.Money);
+
+        archetypes.push_back(Regression::Archetype("0 Money", broke));
+
+        auto laden = Character::WARLOCK;
+
+        for (auto type = (int)Item::Type::First; laden.Items.size() < laden.ITEM_LIMIT && type <= (int)Item::Type::Last; type++)
+        {
+            Character::GET_UNIQUE_ITEMS(laden, {Item::Base(static_cast<Item::Type>(type))});
+        }
+
+        archetypes.push_back(Regression::Archetype("Full inventory", laden));
+
+        auto initiated = Character::MARINER;
+
+        for (auto codeword = (int)Codeword::Type::First; codeword <= (int)Codeword::Type::Last; codeword++)
+        {
+            Character::GET_CODEWORDS(initiated, {static_cast<Codeword::Type>(codeword)});
+        }
+
+        archetypes.push_back(Regression::Archetype("Every codeword", initiated));
+
+        auto captain = Character::SWASHBUCKLER;
+
+        Character::TAKE_SHIP(captain, Ship::LADY_OF_SHALOTT);
+
+        archetypes.push_back(Regression::Archetype("Ship", captain));
+
+        return archetypes;
+    }
+
+    bool EXISTS(int id)
+    {
+        return Engine::FIND(id) != &notImplemented;
+    }
+
+    // enters one section and plays it through, taking the first answer to every prompt, until the section is left
+    void CHECK(Regression::Report &report, int id, const Regression::Archetype &archetype)
+    {
+        auto fail = [&](std::string what)
+        {
+            report.Failures.push_back(Regression::Failure(id, archetype.Name, what));
+        };
+
+        report.Cases++;
+
+        try
+        {
+            // background jumps on their own, since Engine::ENTER stops quietly at the jump limit
+            auto player = archetype.Player;
+
+            auto story = Engine::FIND(id);
+
+            auto jump = story->Background(player);
+
+            for (auto i = 0; jump >= 0 && i < Engine::JUMP_LIMIT; i++)
+            {
+                story = Engine::FIND(jump);
+
+                if (story == &notImplemented)
+                {
+                    fail("background jump to missing section " + std::to_string(jump));
+
+                    return;
+                }
+
+                jump = story->Background(player);
+            }
+
+            if (jump >= 0)
+            {
+                fail("background jumps never settle");
+
+                return;
+            }
+
+            auto session = Engine::Session();
+
+            session.Hold = true;
+
+            session.ActionLimit = 0;
+
+            session.Player = archetype.Player;
+
+            Engine::RESUME(session, id);
+
+            auto &entered = session.Player;
+
+            if (entered.Life > entered.MAX_LIFE_LIMIT)
+            {
+                fail("Life " + std::to_string(entered.Life) + " above its limit of " + std::to_string(entered.MAX_LIFE_LIMIT));
+            }
+
+            if (entered.Hash != Zobrist::STATE(entered))
+            {
+                fail("hash out of step with the character");
+            }
+
+            auto &choices = session.Section->Choices;
+
+            for (auto i = 0; i < choices.size(); i++)
+            {
+                if (!Regression::EXISTS(choices[i].Destination))
+                {
+                    fail("choice " + std::to_string(i) + " leads to missing section " + std::to_string(choices[i].Destination));
+                }
+            }
+
+            for (auto steps = 0; session.Prompt != Engine::Prompt::NONE && session.Prompt != Engine::Prompt::END; steps++)
+            {
+                if (steps >= 64)
+                {
+                    fail(std::string("still at ") + Engine::Prompts[(int)session.Prompt] + " after 64 answers");
+
+                    return;
+                }
+
+                if (session.Prompt == Engine::Prompt::CHOICE && session.Player.Items.size() > session.Player.ITEM_LIMIT)
+                {
+                    fail(std::to_string(session.Player.Items.size()) + " items carried into the choice, limit is " + std::to_string(session.Player.ITEM_LIMIT));
+                }
+
+                auto options = Engine::OPTIONS(session);
+
+                if (options.size() == 0)
+                {
+                    fail(std::string("no answer to ") + Engine::Prompts[(int)session.Prompt]);
+
+                    return;
+                }
+
+                Engine::APPLY(session, options[0]);
+            }
+
+            if (session.Prompt == Engine::Prompt::NONE)
+            {
+                if (session.Player.Items.size() > session.Player.ITEM_LIMIT)
+                {
+                    fail(std::to_string(session.Player.Items.size()) + " items carried out of the section, limit is " + std::to_string(session.Player.ITEM_LIMIT));
+                }
+
+                if (!Regression::EXISTS(session.Next))
+                {
+                    fail("leads to missing section " + std::to_string(session.Next));
+                }
+            }
+            else if (session.Ending == Engine::Ending::LOOP || session.Ending == Engine::Ending::MISSING)
+            {
+                fail(std::string("ends in ") + Engine::Endings[(int)session.Ending]);
+            }
+        }
+        catch (const std::exception &e)
+        {
+            fail(std::string("threw ") + e.what());
+        }
+    }
+
+    void RUN(Regression::Report &report, std::atomic<int> &next, const std::vector<Regression::Archetype> &archetypes)
+    {
+        for (auto section = next++; section < StoryGraph::SECTIONS; section = next++)
+        {
+            for (auto i = 0; i < archetypes.size(); i++)
+            {
+                Regression::CHECK(report, StoryGraph::IDS[section], archetypes[i]);
+            }
+        }
+    }
+
+    // every section against every archetype, sections shared out between threads
+    Regression::Report REGRESS(int threads)
+    {
+        threads = std::max(1, threads);
+
+        auto archetypes = Regression::ARCHETYPES();
+
+        auto next = std::atomic<int>(0);
+
+        auto reports = std::vector<Regression::Report>(threads);
+
+        auto workers = std::vector<std::thread>();
+
+        for (auto i = 0; i < threads; i++)
+        {
+            workers.push_back(std::thread(Regression::RUN, std::ref(reports[i]), std::ref(next), std::cref(archetypes)));
+        }
+
+        for (auto i = 0; i < workers.size(); i++)
+        {
+            workers[i].join();
+        }
+
+        auto report = Regression::Report();
+
+        for (auto i = 0; i < reports.size(); i++)
+        {
+            report.MERGE(reports[i]);
+        }
+
+        std::sort(report.Failures.begin(), report.Failures.end(), [](const Regression::Failure &a, const Regression::Failure &b)
+                  { return a.Section < b.Section || (a.Section == b.Section && a.Archetype < b.Archetype); });
+
+        return report;
+    }
+
+} // namespace Regression
+
+#endif
@@ -0,0 +1,260 @@
+#ifndef __REWIND__HPP__
+#define __REWIND__HPP__
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "binary.hpp"
+#include "character.hpp"
+
+// Ring of the character as it entered each recent section, so the player can step back without replaying anything
+namespace Rewind
+{
+    typedef std::vector<std::string> Fields;
+
+    // a keyframe holds every encoded field of the character, other snapshots only the fields that differ from their keyframe
+    class Snapshot
+    {
+    public:
+        int Section = -1;
+
+        bool Key = true;
+
+        // sequence number of the keyframe a delta applies to
+        long long Base = -1;
+
+        std::string Bytes = std::string();
+    };
+
+    std::string PACK(const Rewind::Fields &fields)
+    {
+        auto writer = Binary::Writer();
+
+        for (auto i = 0; i < fields.size(); i++)
+        {
+            writer.UNSIGNED(fields[i].size());
+
+            writer.Bytes += fields[i];
+        }
+
+        return writer.Bytes;
+    }
+
+    Rewind::Fields UNPACK(const std::string &bytes)
+    {
+        auto fields = Rewind::Fields();
+
+        auto reader = Binary::Reader(bytes);
+
+        while (!reader.END())
+        {
+            auto length = reader.LENGTH();
+
+            fields.push_back(bytes.substr(reader.Position, length));
+
+            reader.Position += length;
+        }
+
+        return fields;
+    }
+
+    // a bit for each field that changed, followed by the changed fields
+    std::string DELTA(const Rewind::Fields &base, const Rewind::Fields &fields)
+    {
+        auto mask = std::uint64_t(0);
+
+        auto changed = Rewind::Fields();
+
+        for (auto i = 0; i < fields.size(); i++)
+        {
+            if (i >= base.size() || fields[i] != base[i])
+            {
+                mask |= std::uint64_t(1) << i;
+
+                changed.push_back(fields[i]);
+            }
+        }
+
+        auto writer = Binary::Writer();
+
+        writer.UNSIGNED(mask);
+
+        writer.Bytes += Rewind::PACK(changed);
+
+        return writer.Bytes;
+    }
+
+    Rewind::Fields PATCH(Rewind::Fields fields, const std::string &delta)
+    {
+        auto reader = Binary::Reader(delta);
+
+        auto mask = reader.UNSIGNED();
+
+        for (auto i = 0; i < fields.size() && reader.Good; i++)
+        {
+            if (mask & (std::uint64_t(1) << i))
+            {
+                auto length = reader.LENGTH();
+
+                fields[i] = delta.substr(reader.Position, length);
+
+                reader.Position += length;
+            }
+        }
+
+        return fields;
+    }
+
+    class Ring
+    {
+    public:
+        std::vector<Rewind::Snapshot> Entries;
+
+        // a keyframe every this many snapshots, bounds the work of restoring any one of them
+        int Interval = 16;
+
+        // sequence numbers of the oldest snapshot kept and of the next one to be pushed
+        long long First = 0;
+
+        long long Next = 0;
+
+        Ring(int capacity) : Entries(std::max(1, capacity))
+        {
+        }
+
+        Rewind::Snapshot &AT(long long sequence)
+        {
+            return Entries[sequence % Entries.size()];
+        }
+
+        int SIZE()
+        {
+            return (int)(Next - First);
+        }
+
+        void CLEAR()
+        {
+            First = Next = 0;
+        }
+
+        // at most one keyframe and one delta to decode, however far back the snapshot is
+        Rewind::Fields FIELDS(long long sequence)
+        {
+            auto &snapshot = AT(sequence);
+
+            return snapshot.Key ? Rewind::UNPACK(snapshot.Bytes) : Rewind::PATCH(Rewind::UNPACK(AT(snapshot.Base).Bytes), snapshot.Bytes);
+        }
+
+        // dropping a keyframe turns the snapshot after it into one and rebases the deltas that followed
+        void EVICT()
+        {
+            auto evicted = First++;
+
+            if (First < Next && !AT(First).Key && AT(First).Base == evicted)
+            {
+                auto key = FIELDS(First);
+
+                for (auto sequence = First + 1; sequence < Next && !AT(sequence).Key && AT(sequence).Base == evicted; sequence++)
+                {
+                    AT(sequence).Bytes = Rewind::DELTA(key, FIELDS(sequence));
+
+                    AT(sequence).Base = First;
+                }
+
+                AT(First).Bytes = Rewind::PACK(key);
+
+                AT(First).Key = true;
+
+                AT(First).Base = -1;
+            }
+        }
+
+        void PUSH(int section, const Character::Base &player)
+        {
+            if (SIZE() == (int)Entries.size())
+            {
+                EVICT();
+            }
+
+            auto fields = Binary::Writer::FIELDS(player);
+
+            auto last = Next - 1;
+
+            auto base = Next > First ? (AT(last).Key ? last : AT(last).Base) : -1;
+
+            auto &snapshot = AT(Next);
+
+            snapshot.Section = section;
+
+            snapshot.Key = base < 0 || Next - base >= Interval;
+
+            snapshot.Base = snapshot.Key ? -1 : base;
+
+            snapshot.Bytes = snapshot.Key ? Rewind::PACK(fields) : Rewind::DELTA(Rewind::UNPACK(AT(base).Bytes), fields);
+
+            Next++;
+        }
+
+        // section entered that many steps back, -1 if it is no longer kept
+        int SECTION(int steps)
+        {
+            return (steps >= 0 && steps < SIZE()) ? AT(Next - 1 - steps).Section : -1;
+        }
+
+        // restores the character as it entered the section that many steps back and forgets everything after it,
+        // the section is expected to push its snapshot again when it is re-entered
+        bool REWIND(int steps, int &section, Character::Base &player)
+        {
+            if (steps < 0 || steps >= SIZE())
+            {
+                return false;
+            }
+
+            auto target = Next - 1 - steps;
+
+            auto fields = FIELDS(target);
+
+            auto bytes = std::string();
+
+            for (auto i = 0; i < fields.size(); i++)
+            {
+                bytes += fields[i];
+            }
+
+            auto reader = Binary::Reader(bytes);
+
+            auto restored = reader.CHARACTER();
+
+            if (!reader.Good)
+            {
+                return false;
+            }
+
+            section = AT(target).Section;
+
+            player = restored;
+
+            Next = target;
+
+            return true;
+        }
+
+        // memory held by the encoded snapshots
+        std::size_t MEMORY()
+        {
+            auto size = std::size_t(0);
+
+            for (auto sequence = First; sequence < Next; sequence++)
+            {
+                size += AT(sequence).Bytes.size();
+            }
+
+            return size;
+        }
+    };
+
+} // namespace Rewind
+
+#endif
@@ -0,0 +1,358 @@
+#ifndef __SAVECHECK__HPP__
+#define __SAVECHECK__HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "autosave.hpp"
+#include "character.hpp"
+#include "engine.hpp"
+#include "savefile.hpp"
+#include "saveindex.hpp"
+#include "saveslot.hpp"
+
+// Every save in a directory read and checked against the rules, JSON saves rewritten in the binary format if asked
+namespace SaveCheck
+{
+    class Problem
+    {
+    public:
+        std::string File = std::string();
+
+        std::string What = std::string();
+
+        Problem(std::string file, std::string what) : File(file), What(what)
+        {
+        }
+    };
+
+    class Report
+    {
+    public:
+        long long Files = 0;
+
+        long long Binary = 0;
+
+        long long JSON = 0;
+
+        long long Autosaves = 0;
+
+        long long Slots = 0;
+
+        // saves with at least one problem
+        long long Invalid = 0;
+
+        // JSON saves rewritten in the binary format
+        long long Migrated = 0;
+
+        std::vector<SaveCheck::Problem> Problems = std::vector<SaveCheck::Problem>();
+
+        void MERGE(const SaveCheck::Report &other)
+        {
+            Files += other.Files;
+
+            Binary += other.Binary;
+
+            JSON += other.JSON;
+
+            Autosaves += other.Autosaves;
+
+            Slots += other.Slots;
+
+            Invalid += other.Invalid;
+
+            Migrated += other.Migrated;
+
+            Problems.insert(Problems.end(), other.Problems.begin(), other.Problems.end());
+        }
+    };
+
+    // what is wrong with a character the loaders accepted, nothing if it could have been saved by the game
+    std::vector<std::string> PROBLEMS(const Character::Base &player)
+    {
+        auto problems = std::vector<std::string>();
+
+        if (player.Type < Character::Type::CUSTOM || player.Type > Character::Type::WARLOCK)
+        {
+            problems.push_back("character type " + std::to_string((int)player.Type) + " does not exist");
+        }
+
+        if (Engine::FIND(player.StoryID) == &notImplemented)
+        {
+            problems.push_back("section " + std::to_string(player.StoryID) + " does not exist");
+        }
+
+        if (player.MAX_LIFE_LIMIT <= 0 || player.ITEM_LIMIT < 0 || player.SKILLS_LIMIT < 0)
+        {
+            problems.push_back("limits of " + std::to_string(player.MAX_LIFE_LIMIT) + " Life, " + std::to_string(player.ITEM_LIMIT) + " items and " + std::to_string(player.SKILLS_LIMIT) + " skills");
+        }
+
+        if (player.Life <= 0 || player.Life > player.MAX_LIFE_LIMIT)
+        {
+            problems.push_back("Life " + std::to_string(player.Life) + " outside 1 to " + std::to_string(player.MAX_LIFE_LIMIT));
+        }
+
+        if (player.Money < 0 || player.LostMoney < 0)
+        {
+            problems.push_back("negative money");
+        }
+
+        if (player.Items.size() > player.ITEM_LIMIT)
+        {
+            problems.push_back(std::to_string(player.Items.size()) + " items, limit is " + std::to_string(player.ITEM_LIMIT));
+        }
+
+        if (player.Skills.size() > player.SKILLS_LIMIT)
+        {
+            problems.push_back(std::to_string(player.Skills.size()) + " skills, limit is " + std::to_string(player.SKILLS_LIMIT));
+        }
+
+        for (auto list : {&player.Items, &player.LostItems})
+        {
+            for (auto i = 0; i < list->size(); i++)
+            {
+                if (!Item::IsValid((*list)[i].Type))
+                {
+                    problems.push_back("item type " + std::to_string((int)(*list)[i].Type) + " does not exist");
+                }
+            }
+        }
+
+        for (auto list : {&player.Skills, &player.LostSkills, &player.TemporarySkills})
+        {
+            for (auto i = 0; i < list->size(); i++)
+            {
+                if (!Skill::IsValid((*list)[i].Type))
+                {
+                    problems.push_back("skill type " + std::to_string((int)(*list)[i].Type) + " does not exist");
+                }
+            }
+        }
+
+        for (auto i = 0; i < player.Codewords.size(); i++)
+        {
+            if (!Codeword::IsValid(player.Codewords[i]))
+            {
+                problems.push_back("codeword " + std::to_string((int)player.Codewords[i]) + " does not exist");
+            }
+        }
+
+        if (player.Ship.Type != Ship::Type::NONE && player.Ship.Stars < 0)
+        {
+            problems.push_back("ship with " + std::to_string(player.Ship.Stars) + " stars");
+        }
+
+        return problems;
+    }
+
+    // reads one save in whatever format it is in and checks what it holds
+    void CHECK(SaveCheck::Report &report, const std::string &file, bool migrate)
+    {
+        auto fail = [&](std::string what)
+        {
+            report.Problems.push_back(SaveCheck::Problem(file, what));
+        };
+
+        auto problems = report.Problems.size();
+
+        report.Files++;
+
+        auto bytes = std::string();
+
+        auto player = Character::Base();
+
+        auto loaded = false;
+
+        if (!SaveFile::READ(file, bytes))
+        {
+            fail("unreadable");
+        }
+        else if (std::filesystem::path(file).extension() == Autosave::EXTENSION)
+        {
+            report.Autosaves++;
+
+            auto recovery = Autosave::RECOVER(bytes);
+
+            if (recovery.Discarded > 0)
+            {
+                fail(std::to_string(recovery.Discarded) + " bytes after the last good record");
+            }
+
+            if (!recovery.Good)
+            {
+                fail("nothing to recover");
+            }
+
+            player = recovery.Player;
+
+            loaded = recovery.Good;
+        }
+        else if (SaveSlot::IsSlot(file))
+        {
+            report.Slots++;
+
+            auto slot = SaveSlot::Slot();
+
+            auto status = slot.PARSE(bytes);
+
+            if (status != SaveFile::Status::OK)
+            {
+                fail(SaveFile::Statuses[(int)status]);
+            }
+
+            // every save in the slot, the latest one is checked below with the others
+            for (auto i = 0; status == SaveFile::Status::OK && i < (int)slot.Entries.size() - 1; i++)
+            {
+                auto save = slot.LOAD(i, player);
+
+                auto rules = save == SaveFile::Status::OK ? SaveCheck::PROBLEMS(player) : std::vector<std::string>({SaveFile::Statuses[(int)save]});
+
+                for (auto j = 0; j < rules.size(); j++)
+                {
+                    fail("save " + std::to_string(i) + ": " + rules[j]);
+                }
+            }
+
+            if (status == SaveFile::Status::OK && slot.Entries.size() > 0)
+            {
+                status = slot.LOAD(slot.Entries.size() - 1, player);
+
+                if (status != SaveFile::Status::OK)
+                {
+                    fail("latest save: " + std::string(SaveFile::Statuses[(int)status]));
+                }
+            }
+
+            loaded = status == SaveFile::Status::OK && slot.Entries.size() > 0;
+        }
+        else if (SaveFile::IsBinary(bytes))
+        {
+            report.Binary++;
+
+            auto status = SaveFile::DECODE(bytes, player);
+
+            if (status != SaveFile::Status::OK)
+            {
+                fail(SaveFile::Statuses[(int)status]);
+            }
+
+            loaded = status == SaveFile::Status::OK;
+        }
+        else
+        {
+            report.JSON++;
+
+            auto status = SaveFile::IMPORT(bytes, player);
+
+            if (status != SaveFile::Status::OK)
+            {
+                fail(std::string("JSON ") + SaveFile::Statuses[(int)status]);
+            }
+
+            loaded = status == SaveFile::Status::OK;
+        }
+
+        if (loaded)
+        {
+            auto rules = SaveCheck::PROBLEMS(player);
+
+            for (auto i = 0; i < rules.size(); i++)
+            {
+                fail(rules[i]);
+            }
+        }
+
+        if (report.Problems.size() > problems)
+        {
+            report.Invalid++;
+        }
+        else if (migrate && loaded && !SaveFile::IsBinary(bytes) && std::filesystem::path(file).extension() != Autosave::EXTENSION && !SaveSlot::IsSlot(file))
+        {
+            // only saves with nothing wrong with them, the rest are left for someone to look at
+            if (SaveFile::COMMIT(file, SaveFile::ENCODE(player)))
+            {
+                report.Migrated++;
+            }
+            else
+            {
+                fail("unable to rewrite");
+
+                report.Invalid++;
+            }
+        }
+    }
+
+    void RUN(SaveCheck::Report &report, std::atomic<int> &next, const std::vector<std::string> &files, bool migrate)
+    {
+        for (auto file = next++; file < files.size(); file = next++)
+        {
+            SaveCheck::CHECK(report, files[file], migrate);
+        }
+    }
+
+    // the saves in a directory, in no particular order
+    std::vector<std::string> FILES(const std::string &directory)
+    {
+        auto files = std::vector<std::string>();
+
+        auto error = std::error_code();
+
+        for (auto entry = std::filesystem::directory_iterator(directory, error); !error && entry != std::filesystem::directory_iterator(); entry.increment(error))
+        {
+            if (SaveIndex::IsSave(entry->path()))
+            {
+                files.push_back(entry->path().string());
+            }
+        }
+
+        return files;
+    }
+
+    // every save shared out between threads, problems sorted by file
+    SaveCheck::Report VALIDATE(const std::vector<std::string> &files, int threads, bool migrate)
+    {
+        threads = std::max(1, threads);
+
+        auto interned = Character::INTERNED();
+
+        auto next = std::atomic<int>(0);
+
+        auto reports = std::vector<SaveCheck::Report>(threads);
+
+        auto workers = std::vector<std::thread>();
+
+        for (auto i = 0; i < threads; i++)
+        {
+            workers.push_back(std::thread(SaveCheck::RUN, std::ref(reports[i]), std::ref(next), std::cref(files), migrate));
+        }
+
+        for (auto i = 0; i < workers.size(); i++)
+        {
+            workers[i].join();
+        }
+
+        // the reports keep no characters, so the names of every save read can go rather than grow with the directory
+        Character::RELEASE(interned);
+
+        auto report = SaveCheck::Report();
+
+        for (auto i = 0; i < reports.size(); i++)
+        {
+            report.MERGE(reports[i]);
+        }
+
+        std::stable_sort(report.Problems.begin(), report.Problems.end(), [](const SaveCheck::Problem &a, const SaveCheck::Problem &b)
+                         { return a.File < b.File; });
+
+        return report;
+    }
+
+} // namespace SaveCheck
+
+#endif
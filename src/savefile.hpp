@@ -0,0 +1,1069 @@
+#ifndef __SAVEFILE__HPP__
+#define __SAVEFILE__HPP__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <io.h>
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "nlohmann/json.hpp"
+
+#include "binary.hpp"
+#include "character.hpp"
+#include "thumbnail.hpp"
+
+// Saved games: a checksummed binary format read and written in one go, with the original JSON kept for export and import
+namespace SaveFile
+{
+    enum class Status
+    {
+        OK = 0,
+        UNREADABLE,
+        NOT_BINARY,
+        VERSION,
+        TRUNCATED,
+        CHECKSUM,
+        MALFORMED,
+        First = OK,
+        Last = MALFORMED
+    };
+
+    constexpr const char *Statuses[] = {"OK", "UNREADABLE", "NOT_BINARY", "VERSION", "TRUNCATED", "CHECKSUM", "MALFORMED"};
+
+    static_assert(sizeof(SaveFile::Statuses) / sizeof(const char *) == (int)SaveFile::Status::Last + 1, "every status needs its own entry in SaveFile::Statuses, in enum order");
+
+    const char MAGIC[] = "DMS";
+
+    const int VERSION = 1;
+
+    // magic, version, payload size and payload checksum
+    const int HEADER = sizeof(SaveFile::MAGIC) - 1 + 1 + 4 + 4;
+
+    // the name and description of one of the predefined classes are not stored, only those of custom characters
+    const int CLASS_NAMES = 0;
+
+    const int CUSTOM_NAMES = 1;
+
+    bool IsBinary(const std::string &bytes)
+    {
+        return bytes.size() >= sizeof(SaveFile::MAGIC) - 1 && bytes.compare(0, sizeof(SaveFile::MAGIC) - 1, SaveFile::MAGIC) == 0;
+    }
+
+    // the predefined class the character's name and description come from, NULL for custom ones
+    const Character::Base *CLASS(const Character::Base &player)
+    {
+        for (auto i = 0; i < Character::Classes.size(); i++)
+        {
+            auto &character = Character::Classes[i];
+
+            if (character.Type == player.Type && std::strcmp(character.Name, player.Name) == 0 && std::strcmp(character.Description, player.Description) == 0)
+            {
+                return &character;
+            }
+        }
+
+        return NULL;
+    }
+
+    std::string ENCODE(const Character::Base &player)
+    {
+        auto writer = Binary::Writer();
+
+        writer.Bytes.append(SaveFile::MAGIC, sizeof(SaveFile::MAGIC) - 1);
+
+        writer.BYTE(SaveFile::VERSION);
+
+        // size and checksum are filled in once the payload is known
+        writer.FIXED32(0);
+
+        writer.FIXED32(0);
+
+        auto fields = Binary::Writer::FIELDS(player);
+
+        if (SaveFile::CLASS(player))
+        {
+            writer.BYTE(SaveFile::CLASS_NAMES);
+        }
+        else
+        {
+            writer.BYTE(SaveFile::CUSTOM_NAMES);
+
+            writer.Bytes += fields[0];
+
+            writer.Bytes += fields[1];
+        }
+
+        for (auto i = 2; i < fields.size(); i++)
+        {
+            writer.Bytes += fields[i];
+        }
+
+        auto payload = writer.Bytes.size() - SaveFile::HEADER;
+
+        auto crc = Binary::CRC32((const std::uint8_t *)writer.Bytes.data() + SaveFile::HEADER, payload);
+
+        auto header = Binary::Writer();
+
+        header.FIXED32(payload);
+
+        header.FIXED32(crc);
+
+        writer.Bytes.replace(SaveFile::HEADER - 8, 8, header.Bytes);
+
+        return writer.Bytes;
+    }
+
+    SaveFile::Status DECODE(const std::string &bytes, Character::Base &player)
+    {
+        if (!SaveFile::IsBinary(bytes))
+        {
+            return SaveFile::Status::NOT_BINARY;
+        }
+        else if (bytes.size() < SaveFile::HEADER)
+        {
+            return SaveFile::Status::TRUNCATED;
+        }
+
+        auto header = Binary::Reader((const std::uint8_t *)bytes.data() + sizeof(SaveFile::MAGIC) - 1, SaveFile::HEADER - sizeof(SaveFile::MAGIC) + 1);
+
+        auto version = header.BYTE();
+
+        auto payload = header.FIXED32();
+
+        auto crc = header.FIXED32();
+
+        if (version != SaveFile::VERSION)
+        {
+            return SaveFile::Status::VERSION;
+        }
+        else if (bytes.size() - SaveFile::HEADER < payload)
+        {
+            return SaveFile::Status::TRUNCATED;
+        }
+        else if (Binary::CRC32((const std::uint8_t *)bytes.data() + SaveFile::HEADER, payload) != crc)
+        {
+            return SaveFile::Status::CHECKSUM;
+        }
+
+        auto reader = Binary::Reader((const std::uint8_t *)bytes.data() + SaveFile::HEADER, payload);
+
+        auto character = Character::Base();
+
+        auto names = reader.BYTE();
+
+        if (names == SaveFile::CUSTOM_NAMES)
+        {
+            character.Name = Character::INTERN(reader.STRING());
+
+            character.Description = Character::INTERN(reader.STRING());
+        }
+        else if (names != SaveFile::CLASS_NAMES)
+        {
+            return SaveFile::Status::MALFORMED;
+        }
+
+        reader.STATE(character);
+
+        if (!reader.Good || !reader.END())
+        {
+            return SaveFile::Status::MALFORMED;
+        }
+
+        if (names == SaveFile::CLASS_NAMES)
+        {
+            auto found = false;
+
+            for (auto i = 0; i < Character::Classes.size() && !found; i++)
+            {
+                if (Character::Classes[i].Type == character.Type)
+                {
+                    character.Name = Character::Classes[i].Name;
+
+                    character.Description = Character::Classes[i].Description;
+
+                    found = true;
+                }
+            }
+
+            if (!found)
+            {
+                return SaveFile::Status::MALFORMED;
+            }
+        }
+
+        player = character;
+
+        return SaveFile::Status::OK;
+    }
+
+    // the JSON saves were always written in
+    std::string EXPORT(const Character::Base &player)
+    {
+        nlohmann::json data;
+
+        data["name"] = player.Name;
+        data["description"] = player.Description;
+        data["type"] = player.Type;
+        data["life"] = player.Life;
+        data["money"] = player.Money;
+        data["itemLimit"] = player.ITEM_LIMIT;
+        data["lifeLimit"] = player.MAX_LIFE_LIMIT;
+        data["skillsLimit"] = player.SKILLS_LIMIT;
+        data["codewords"] = player.Codewords;
+        data["epoch"] = player.Epoch;
+
+        auto skills = std::vector<Skill::Type>();
+        auto lostSkills = std::vector<Skill::Type>();
+        auto temporarySkills = std::vector<Skill::Type>();
+
+        for (auto i = 0; i < player.Skills.size(); i++)
+        {
+            skills.push_back(player.Skills[i].Type);
+        }
+
+        for (auto i = 0; i < player.LostSkills.size(); i++)
+        {
+            lostSkills.push_back(player.LostSkills[i].Type);
+        }
+
+        for (auto i = 0; i < player.TemporarySkills.size(); i++)
+        {
+            temporarySkills.push_back(player.TemporarySkills[i].Type);
+        }
+
+        data["skills"] = skills;
+        data["lostSkills"] = lostSkills;
+        data["temporarySkills"] = temporarySkills;
+        data["lostMoney"] = player.LostMoney;
+        data["storyID"] = player.StoryID;
+
+        auto items = std::vector<nlohmann::json>();
+        auto lostItems = std::vector<nlohmann::json>();
+
+        for (auto i = 0; i < player.Items.size(); i++)
+        {
+            nlohmann::json item;
+
+            item.emplace("name", player.Items[i].Name());
+            item.emplace("description", player.Items[i].Description());
+            item.emplace("type", player.Items[i].Type);
+            item.emplace("charge", player.Items[i].Charge);
+
+            items.push_back(item);
+        }
+
+        for (auto i = 0; i < player.LostItems.size(); i++)
+        {
+            nlohmann::json item;
+
+            item.emplace("name", player.LostItems[i].Name());
+            item.emplace("description", player.LostItems[i].Description());
+            item.emplace("type", player.LostItems[i].Type);
+            item.emplace("charge", player.LostItems[i].Charge);
+
+            lostItems.push_back(item);
+        }
+
+        if (player.Ship.Type != Ship::Type::NONE)
+        {
+            nlohmann::json ship;
+
+            ship.emplace("name", player.Ship.Name);
+            ship.emplace("stars", player.Ship.Stars);
+            ship.emplace("type", player.Ship.Type);
+
+            data["ship"] = ship;
+        }
+
+        data["lostItems"] = lostItems;
+        data["items"] = items;
+
+        return data.dump();
+    }
+
+    // the keys of a JSON save, see Importer
+    enum class Key
+    {
+        NONE = 0,
+        NAME,
+        DESCRIPTION,
+        TYPE,
+        LIFE,
+        MONEY,
+        ITEM_LIMIT,
+        LIFE_LIMIT,
+        SKILLS_LIMIT,
+        LOST_MONEY,
+        STORY_ID,
+        EPOCH,
+        CODEWORDS,
+        SKILLS,
+        LOST_SKILLS,
+        TEMPORARY_SKILLS,
+        ITEMS,
+        LOST_ITEMS,
+        SHIP,
+        CHARGE,
+        STARS,
+        First = NONE,
+        Last = STARS
+    };
+
+    constexpr const char *Keys[] = {"", "name", "description", "type", "life", "money", "itemLimit", "lifeLimit", "skillsLimit", "lostMoney", "storyID", "epoch", "codewords", "skills", "lostSkills", "temporarySkills", "items", "lostItems", "ship", "charge", "stars"};
+
+    static_assert(sizeof(SaveFile::Keys) / sizeof(const char *) == (int)SaveFile::Key::Last + 1, "every key needs its own entry in SaveFile::Keys, in enum order");
+
+    SaveFile::Key KEY(const std::string &key)
+    {
+        for (auto i = (int)SaveFile::Key::First + 1; i <= (int)SaveFile::Key::Last; i++)
+        {
+            if (key == SaveFile::Keys[i])
+            {
+                return static_cast<SaveFile::Key>(i);
+            }
+        }
+
+        return SaveFile::Key::NONE;
+    }
+
+    // reads a JSON save as it is parsed, straight into the character and without building the document first;
+    // accepts what the document based loader accepted: temporarySkills, ship and epoch may be missing and a bad ship or epoch is ignored
+    class Importer : public nlohmann::json_sax<nlohmann::json>
+    {
+    public:
+        Character::Base Player = Character::Base();
+
+        // the top level fields that every save has, by SaveFile::Key
+        std::uint32_t Required = 0;
+
+        std::uint32_t Found = 0;
+
+        // objects and arrays entered, the save itself is depth 1
+        int Depth = 0;
+
+        // key of the value at depth 1, and of the value inside a ship or item
+        SaveFile::Key Top = SaveFile::Key::NONE;
+
+        SaveFile::Key Field = SaveFile::Key::NONE;
+
+        // item being read, and which of its type, charge and name were found
+        Item::Type ItemType = Item::Type::NONE;
+
+        int Charge = 0;
+
+        std::string ItemName = std::string();
+
+        int ItemFields = 0;
+
+        Ship::Type ShipType = Ship::Type::NONE;
+
+        int Stars = 0;
+
+        // which of the ship's type and stars were found, -1 once either is not a number
+        int ShipFields = 0;
+
+        Importer()
+        {
+            auto required = {SaveFile::Key::NAME, SaveFile::Key::DESCRIPTION, SaveFile::Key::TYPE, SaveFile::Key::LIFE, SaveFile::Key::MONEY, SaveFile::Key::ITEM_LIMIT, SaveFile::Key::LIFE_LIMIT, SaveFile::Key::SKILLS_LIMIT, SaveFile::Key::LOST_MONEY, SaveFile::Key::STORY_ID};
+
+            for (auto key : required)
+            {
+                Required |= 1U << (int)key;
+            }
+        }
+
+        bool DONE()
+        {
+            return (Found & Required) == Required;
+        }
+
+        bool ITEMS()
+        {
+            return Top == SaveFile::Key::ITEMS || Top == SaveFile::Key::LOST_ITEMS;
+        }
+
+        bool LIST()
+        {
+            return Top >= SaveFile::Key::CODEWORDS && Top <= SaveFile::Key::LOST_ITEMS;
+        }
+
+        // every number ends up here, the loader read them all as int
+        bool NUMBER(long long value)
+        {
+            if (Depth == 1)
+            {
+                Found |= 1U << (int)Top;
+
+                switch (Top)
+                {
+                case SaveFile::Key::TYPE:
+                    Player.Type = static_cast<Character::Type>((int)value);
+                    break;
+                case SaveFile::Key::LIFE:
+                    Player.Life = (int)value;
+                    break;
+                case SaveFile::Key::MONEY:
+                    Player.Money = (int)value;
+                    break;
+                case SaveFile::Key::ITEM_LIMIT:
+                    Player.ITEM_LIMIT = (int)value;
+                    break;
+                case SaveFile::Key::LIFE_LIMIT:
+                    Player.MAX_LIFE_LIMIT = (int)value;
+                    break;
+                case SaveFile::Key::SKILLS_LIMIT:
+                    Player.SKILLS_LIMIT = (int)value;
+                    break;
+                case SaveFile::Key::LOST_MONEY:
+                    Player.LostMoney = (int)value;
+                    break;
+                case SaveFile::Key::STORY_ID:
+                    Player.StoryID = (int)value;
+                    break;
+                case SaveFile::Key::EPOCH:
+                    Player.Epoch = value;
+                    break;
+                case SaveFile::Key::NAME:
+                case SaveFile::Key::DESCRIPTION:
+                    return false;
+                default:
+                    return !LIST();
+                }
+            }
+            else if (Depth == 2 && Top == SaveFile::Key::CODEWORDS)
+            {
+                Player.Codewords.push_back(static_cast<Codeword::Type>((int)value));
+            }
+            else if (Depth == 2 && (Top == SaveFile::Key::SKILLS || Top == SaveFile::Key::LOST_SKILLS || Top == SaveFile::Key::TEMPORARY_SKILLS))
+            {
+                auto skill = static_cast<Skill::Type>((int)value);
+
+                if (Skill::IsValid(skill))
+                {
+                    auto &skills = Top == SaveFile::Key::SKILLS ? Player.Skills : (Top == SaveFile::Key::LOST_SKILLS ? Player.LostSkills : Player.TemporarySkills);
+
+                    skills.push_back(Skill::ALL[(int)skill]);
+                }
+            }
+            else if (Depth == 2 && Top == SaveFile::Key::SHIP)
+            {
+                if (Field == SaveFile::Key::TYPE)
+                {
+                    ShipType = static_cast<Ship::Type>((int)value);
+
+                    ShipFields |= ShipFields >= 0 ? 1 : 0;
+                }
+                else if (Field == SaveFile::Key::STARS)
+                {
+                    Stars = (int)value;
+
+                    ShipFields |= ShipFields >= 0 ? 2 : 0;
+                }
+            }
+            else if (Depth == 2 && ITEMS())
+            {
+                return false;
+            }
+            else if (Depth == 3 && ITEMS())
+            {
+                if (Field == SaveFile::Key::TYPE)
+                {
+                    ItemType = static_cast<Item::Type>((int)value);
+
+                    ItemFields |= 1;
+                }
+                else if (Field == SaveFile::Key::CHARGE)
+                {
+                    Charge = (int)value;
+
+                    ItemFields |= 2;
+                }
+                else if (Field == SaveFile::Key::NAME)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // a value that is not what its key holds, which only matters for the fields the loader could not do without
+        bool OTHER(bool null)
+        {
+            if (Depth == 1)
+            {
+                return Top == SaveFile::Key::NONE || Top == SaveFile::Key::EPOCH || Top == SaveFile::Key::SHIP || (null && LIST());
+            }
+            else if (Depth == 2 && Top == SaveFile::Key::SHIP)
+            {
+                if (Field == SaveFile::Key::TYPE || Field == SaveFile::Key::STARS)
+                {
+                    ShipFields = -1;
+                }
+            }
+            else if (Depth == 2)
+            {
+                return !LIST();
+            }
+            else if (Depth == 3 && ITEMS())
+            {
+                return Field != SaveFile::Key::TYPE && Field != SaveFile::Key::CHARGE && Field != SaveFile::Key::NAME;
+            }
+
+            return true;
+        }
+
+        // an object or array is about to be entered
+        bool START(bool array)
+        {
+            auto good = true;
+
+            if (Depth == 1 && array && LIST())
+            {
+                // a repeated key replaces the list, as it did in the document
+                switch (Top)
+                {
+                case SaveFile::Key::CODEWORDS:
+                    Player.Codewords.clear();
+                    break;
+                case SaveFile::Key::SKILLS:
+                    Player.Skills.clear();
+                    break;
+                case SaveFile::Key::LOST_SKILLS:
+                    Player.LostSkills.clear();
+                    break;
+                case SaveFile::Key::TEMPORARY_SKILLS:
+                    Player.TemporarySkills.clear();
+                    break;
+                case SaveFile::Key::ITEMS:
+                    Player.Items.clear();
+                    break;
+                default:
+                    Player.LostItems.clear();
+                    break;
+                }
+            }
+            else if (Depth == 1 && !array && Top == SaveFile::Key::SHIP)
+            {
+                ShipType = Ship::Type::NONE;
+
+                Stars = 0;
+
+                ShipFields = 0;
+            }
+            else if (Depth == 2 && !array && ITEMS())
+            {
+                ItemFields = 0;
+            }
+            else if (Depth > 0)
+            {
+                good = OTHER(false);
+            }
+
+            Depth++;
+
+            return good;
+        }
+
+        bool null() override
+        {
+            return OTHER(true);
+        }
+
+        bool boolean(bool value) override
+        {
+            return NUMBER(value ? 1 : 0);
+        }
+
+        bool number_integer(number_integer_t value) override
+        {
+            return NUMBER(value);
+        }
+
+        bool number_unsigned(number_unsigned_t value) override
+        {
+            return NUMBER((long long)value);
+        }
+
+        bool number_float(number_float_t value, const string_t &) override
+        {
+            return NUMBER((long long)value);
+        }
+
+        bool string(string_t &value) override
+        {
+            if (Depth == 1 && (Top == SaveFile::Key::NAME || Top == SaveFile::Key::DESCRIPTION))
+            {
+                Found |= 1U << (int)Top;
+
+                (Top == SaveFile::Key::NAME ? Player.Name : Player.Description) = Character::INTERN(value);
+
+                return true;
+            }
+            else if (Depth == 3 && ITEMS() && Field == SaveFile::Key::NAME)
+            {
+                ItemName.swap(value);
+
+                ItemFields |= 4;
+
+                return true;
+            }
+
+            return OTHER(false);
+        }
+
+        bool binary(binary_t &) override
+        {
+            return OTHER(false);
+        }
+
+        bool start_object(std::size_t) override
+        {
+            return START(false);
+        }
+
+        bool end_object() override
+        {
+            if (Depth == 2 && Top == SaveFile::Key::SHIP)
+            {
+                Found |= 1U << (int)SaveFile::Key::SHIP;
+
+                Player.Ship = ShipFields == 3 ? Ship::LOOKUP(ShipType) : Ship::NONE;
+
+                if (Player.Ship.Type != Ship::Type::NONE)
+                {
+                    Player.Ship.Stars = Stars;
+                }
+            }
+            else if (Depth == 3 && ITEMS())
+            {
+                if (ItemFields != 7)
+                {
+                    return false;
+                }
+
+                auto &items = Top == SaveFile::Key::ITEMS ? Player.Items : Player.LostItems;
+
+                items.push_back(Item::Base(ItemType, Item::VARIANT(ItemType, ItemName), Charge));
+            }
+
+            Depth--;
+
+            return true;
+        }
+
+        bool start_array(std::size_t) override
+        {
+            return START(true);
+        }
+
+        bool end_array() override
+        {
+            Depth--;
+
+            return true;
+        }
+
+        bool key(string_t &value) override
+        {
+            if (Depth == 1)
+            {
+                Top = SaveFile::KEY(value);
+            }
+            else
+            {
+                Field = SaveFile::KEY(value);
+            }
+
+            return true;
+        }
+
+        bool parse_error(std::size_t, const std::string &, const nlohmann::detail::exception &) override
+        {
+            return false;
+        }
+    };
+
+    // reads a JSON save
+    SaveFile::Status IMPORT(const std::string &text, Character::Base &player)
+    {
+        auto importer = SaveFile::Importer();
+
+        if (!nlohmann::json::sax_parse(text, &importer) || !importer.DONE())
+        {
+            return SaveFile::Status::MALFORMED;
+        }
+
+        if ((importer.Found & (1U << (int)SaveFile::Key::SHIP)) == 0)
+        {
+            importer.Player.Ship = Ship::NONE;
+        }
+
+        Character::REHASH(importer.Player);
+
+        player = importer.Player;
+
+        return SaveFile::Status::OK;
+    }
+
+    // the whole file in a single read
+    bool READ(const std::string &file_name, std::string &bytes)
+    {
+        auto file = std::fopen(file_name.c_str(), "rb");
+
+        if (!file)
+        {
+            return false;
+        }
+
+        std::fseek(file, 0, SEEK_END);
+
+        auto size = std::ftell(file);
+
+        std::fseek(file, 0, SEEK_SET);
+
+        bytes.resize(size > 0 ? size : 0);
+
+        auto good = size >= 0 && std::fread(&bytes[0], 1, bytes.size(), file) == bytes.size();
+
+        std::fclose(file);
+
+        return good;
+    }
+
+    // numbers the temporary files of this process, so two threads committing the same save never share one
+    std::atomic<unsigned long long> Commits(0);
+
+    // writes a temporary file, forces it to disk and renames it over the save, which is left either as it was or complete
+    bool COMMIT(const std::string &file_name, const std::string &bytes)
+    {
+#if defined(_WIN32)
+        auto process = (long long)_getpid();
+#else
+        auto process = (long long)getpid();
+#endif
+
+        // another copy of the game may be saving to the same file at the same time
+        auto temporary = file_name + "." + std::to_string(process) + "." + std::to_string(SaveFile::Commits++) + ".tmp";
+
+        auto file = std::fopen(temporary.c_str(), "wb");
+
+        if (!file)
+        {
+            return false;
+        }
+
+        auto good = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size() && std::fflush(file) == 0;
+
+#if defined(_WIN32)
+        good = good && _commit(_fileno(file)) == 0;
+#else
+        good = good && fsync(fileno(file)) == 0;
+#endif
+
+        good = std::fclose(file) == 0 && good;
+
+        auto error = std::error_code();
+
+        if (good)
+        {
+            std::filesystem::rename(temporary, file_name, error);
+        }
+
+        if (!good || error)
+        {
+            std::filesystem::remove(temporary, error);
+
+            return false;
+        }
+
+#if !defined(_WIN32)
+        // the rename is only durable once the directory holding the save reaches the disk as well
+        auto parent = std::filesystem::path(file_name).parent_path();
+
+        auto directory = open(parent.empty() ? "." : parent.c_str(), O_RDONLY);
+
+        if (directory >= 0)
+        {
+            fsync(directory);
+
+            close(directory);
+        }
+#endif
+
+        return true;
+    }
+
+    // a thumbnail goes after the payload of a binary save, with its own size and checksum, and DECODE never looks at it
+    void ATTACH(std::string &bytes, const Thumbnail::Image &image)
+    {
+        if (image.EMPTY())
+        {
+            return;
+        }
+
+        auto picture = Thumbnail::ENCODE(image);
+
+        auto writer = Binary::Writer();
+
+        writer.FIXED32(picture.size());
+
+        writer.FIXED32(Binary::CRC32((const std::uint8_t *)picture.data(), picture.size()));
+
+        bytes += writer.Bytes;
+
+        bytes += picture;
+    }
+
+    // a thumbnail section written by ATTACH that starts at the given offset and runs to the end of the bytes
+    bool PICTURE(const std::string &bytes, std::size_t start, Thumbnail::Image &image)
+    {
+        if (bytes.size() < start + 8)
+        {
+            return false;
+        }
+
+        auto section = Binary::Reader((const std::uint8_t *)bytes.data() + start, 8);
+
+        auto size = (std::size_t)section.FIXED32();
+
+        auto crc = section.FIXED32();
+
+        auto picture = (const std::uint8_t *)bytes.data() + start + 8;
+
+        return bytes.size() - start - 8 == size && Binary::CRC32(picture, size) == crc && Thumbnail::DECODE(picture, size, image);
+    }
+
+    // the thumbnail of a binary save, false if it has none or it is damaged
+    bool THUMBNAIL(const std::string &bytes, Thumbnail::Image &image)
+    {
+        if (!SaveFile::IsBinary(bytes) || bytes.size() < SaveFile::HEADER)
+        {
+            return false;
+        }
+
+        auto header = Binary::Reader((const std::uint8_t *)bytes.data() + SaveFile::HEADER - 8, 8);
+
+        auto start = SaveFile::HEADER + (std::size_t)header.FIXED32();
+
+        return SaveFile::PICTURE(bytes, start, image);
+    }
+
+    // reads a save in either format
+    SaveFile::Status LOAD(const std::string &file_name, Character::Base &player)
+    {
+        auto bytes = std::string();
+
+        if (!SaveFile::READ(file_name, bytes))
+        {
+            return SaveFile::Status::UNREADABLE;
+        }
+        else if (SaveFile::IsBinary(bytes))
+        {
+            return SaveFile::DECODE(bytes, player);
+        }
+
+        return SaveFile::IMPORT(bytes, player);
+    }
+
+    // binary unless JSON is asked for
+    bool SAVE(const std::string &file_name, const Character::Base &player, bool json = false)
+    {
+        return SaveFile::COMMIT(file_name, json ? SaveFile::EXPORT(player) : SaveFile::ENCODE(player));
+    }
+
+    // a save handed to the writer thread, and what became of it
+    class Job
+    {
+    public:
+        std::string File = std::string();
+
+        std::string Bytes = std::string();
+
+        // as saved, for whoever keeps summaries of the saves
+        Character::Base Player = Character::Base();
+
+        // the screen at the time, shrunk to a thumbnail by the writer thread
+        Thumbnail::Image Frame = Thumbnail::Image();
+
+        // writes the save some other way than committing Bytes, see SaveSlot::WRITE
+        std::function<bool(const SaveFile::Job &)> Write;
+
+        bool Saved = false;
+    };
+
+    // commits saves on a thread of its own so that saving never holds up a frame, the game thread only encodes and the thumbnail is made here
+    class Writer
+    {
+    public:
+        std::mutex Lock;
+
+        std::condition_variable Wake;
+
+        // waiting to be written, at most one per file
+        std::deque<SaveFile::Job> Pending = std::deque<SaveFile::Job>();
+
+        // written or failed, waiting to be collected by POLL
+        std::deque<SaveFile::Job> Finished = std::deque<SaveFile::Job>();
+
+        // a save is being written
+        bool Busy = false;
+
+        bool Quit = false;
+
+        std::thread Worker;
+
+        Writer()
+        {
+            Worker = std::thread(&SaveFile::Writer::RUN, this);
+        }
+
+        // saves already handed over are still written before the program ends
+        ~Writer()
+        {
+            {
+                std::lock_guard<std::mutex> lock(Lock);
+
+                Quit = true;
+            }
+
+            Wake.notify_one();
+
+            Worker.join();
+        }
+
+        void SUBMIT(const std::string &file_name, const Character::Base &player, Thumbnail::Image frame = Thumbnail::Image(), std::function<bool(const SaveFile::Job &)> write = nullptr)
+        {
+            auto job = SaveFile::Job();
+
+            job.File = file_name;
+
+            if (!write)
+            {
+                job.Bytes = SaveFile::ENCODE(player);
+            }
+
+            job.Player = player;
+
+            job.Frame = std::move(frame);
+
+            job.Write = write;
+
+            {
+                std::lock_guard<std::mutex> lock(Lock);
+
+                auto queued = false;
+
+                // a newer save of the same file replaces one that has not been started yet, unless both are kept in it
+                for (auto i = 0; i < Pending.size() && !queued && !write; i++)
+                {
+                    if (Pending[i].File == file_name && !Pending[i].Write)
+                    {
+                        Pending[i] = std::move(job);
+
+                        queued = true;
+                    }
+                }
+
+                if (!queued)
+                {
+                    Pending.push_back(std::move(job));
+                }
+            }
+
+            Wake.notify_one();
+        }
+
+        // the next save that was written or failed, false if there is none yet
+        bool POLL(SaveFile::Job &job)
+        {
+            std::lock_guard<std::mutex> lock(Lock);
+
+            if (Finished.empty())
+            {
+                return false;
+            }
+
+            job = std::move(Finished.front());
+
+            Finished.pop_front();
+
+            return true;
+        }
+
+        bool DONE()
+        {
+            std::lock_guard<std::mutex> lock(Lock);
+
+            return Pending.empty() && !Busy;
+        }
+
+        void RUN()
+        {
+            auto lock = std::unique_lock<std::mutex>(Lock);
+
+            while (true)
+            {
+                Wake.wait(lock, [&]
+                          { return Quit || !Pending.empty(); });
+
+                if (Pending.empty())
+                {
+                    return;
+                }
+
+                auto job = std::move(Pending.front());
+
+                Pending.pop_front();
+
+                Busy = true;
+
+                lock.unlock();
+
+                job.Frame = Thumbnail::SHRINK(job.Frame, Thumbnail::WIDTH, Thumbnail::HEIGHT);
+
+                if (job.Write)
+                {
+                    job.Saved = job.Write(job);
+                }
+                else
+                {
+                    SaveFile::ATTACH(job.Bytes, job.Frame);
+
+                    job.Saved = SaveFile::COMMIT(job.File, job.Bytes);
+                }
+
+                job.Frame = Thumbnail::Image();
+
+                job.Bytes.clear();
+
+                lock.lock();
+
+                Busy = false;
+
+                Finished.push_back(std::move(job));
+            }
+        }
+    };
+
+} // namespace SaveFile
+
+#endif
@@ -0,0 +1,1292 @@
+#ifndef __SAVEINDEX__HPP__
+#define __SAVEINDEX__HPP__
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#endif
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "autosave.hpp"
+#include "binary.hpp"
+#include "character.hpp"
+#include "savefile.hpp"
+#include "saveslot.hpp"
+#include "thumbnail.hpp"
+
+// Summaries of the saved games kept beside them, so listing saves only reads the ones on screen and only when they changed
+namespace SaveIndex
+{
+    const char MAGIC[] = "DMI";
+
+    const int VERSION = 1;
+
+    const char FILE_NAME[] = "saves.index";
+
+    // shared by every copy of the game using the directory, the index file is only used where it cannot be mapped
+    const char CATALOGUE[] = "saves.catalogue";
+
+    const char CATALOGUE_MAGIC[] = "DMC";
+
+    const int CATALOGUE_VERSION = 1;
+
+    const char EXTENSION[] = ".save";
+
+    // what the load screen shows of a save, and the size and time of the file it was read from
+    class Summary
+    {
+    public:
+        // file name within the save directory
+        std::string File = std::string();
+
+        decltype(Character::Base::Epoch) Epoch = 0;
+
+        std::string Name = std::string();
+
+        // -1 when the save could not be read
+        int Section = -1;
+
+        int Life = 0;
+
+        int Money = 0;
+
+        int Items = 0;
+
+        int Codewords = 0;
+
+        long long Time = 0;
+
+        long long Size = -1;
+
+        // false for files found in the directory but not read yet
+        bool Summarised = false;
+    };
+
+    // last write time and size of a file, false if it cannot be examined
+    bool STAMP(const std::filesystem::path &path, long long &time, long long &size)
+    {
+        auto error = std::error_code();
+
+        auto write_time = std::filesystem::last_write_time(path, error);
+
+        if (error)
+        {
+            return false;
+        }
+
+        auto file_size = std::filesystem::file_size(path, error);
+
+        if (error)
+        {
+            return false;
+        }
+
+        time = (long long)write_time.time_since_epoch().count();
+
+        size = (long long)file_size;
+
+        return true;
+    }
+
+    bool IsSave(const std::filesystem::path &path)
+    {
+        // autosaves are listed with the saves so that a game lost to a crash can be picked up again
+        return path.extension() == SaveIndex::EXTENSION || path.extension() == Autosave::EXTENSION || SaveSlot::IsSlot(path);
+    }
+
+    // reports the saves other programs and other copies of the game write, through inotify where there is one,
+    // elsewhere the index looks at the directory's write time every Interval instead
+    class Watcher
+    {
+    public:
+        int Notify = -1;
+
+        std::chrono::milliseconds Interval = std::chrono::milliseconds(1000);
+
+        std::chrono::steady_clock::time_point Checked = std::chrono::steady_clock::time_point();
+
+        Watcher()
+        {
+        }
+
+        ~Watcher()
+        {
+            CLOSE();
+        }
+
+        // no copies, the descriptor belongs to one watcher
+        Watcher(const SaveIndex::Watcher &) = delete;
+
+        SaveIndex::Watcher &operator=(const SaveIndex::Watcher &) = delete;
+
+        // false if changes to the directory have to be polled for
+        bool WATCH(const std::string &directory)
+        {
+            CLOSE();
+
+#if defined(__linux__)
+            Notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+            if (Notify >= 0 && inotify_add_watch(Notify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE) < 0)
+            {
+                CLOSE();
+            }
+#endif
+
+            return Notify >= 0;
+        }
+
+        void CLOSE()
+        {
+#if defined(__linux__)
+            if (Notify >= 0)
+            {
+                close(Notify);
+            }
+#endif
+
+            Notify = -1;
+        }
+
+        // saves written, renamed or deleted since the last call, false if the whole directory has to be looked at instead
+        bool CHANGES(std::vector<std::string> &files)
+        {
+            files.clear();
+
+#if defined(__linux__)
+            if (Notify >= 0)
+            {
+                alignas(inotify_event) char buffer[1 << 12];
+
+                auto overflow = false;
+
+                for (auto length = read(Notify, buffer, sizeof(buffer)); length > 0; length = read(Notify, buffer, sizeof(buffer)))
+                {
+                    for (auto offset = 0; offset < length;)
+                    {
+                        auto event = (const inotify_event *)(buffer + offset);
+
+                        overflow |= (event->mask & IN_Q_OVERFLOW) != 0;
+
+                        if (event->len > 0 && SaveIndex::IsSave(event->name))
+                        {
+                            files.push_back(event->name);
+                        }
+
+                        offset += sizeof(inotify_event) + event->len;
+                    }
+                }
+
+                return !overflow;
+            }
+#endif
+
+            auto now = std::chrono::steady_clock::now();
+
+            if (now - Checked < Interval)
+            {
+                return true;
+            }
+
+            Checked = now;
+
+            return false;
+        }
+    };
+
+    // the summaries as fixed size records in a file every copy of the game maps, changed under an exclusive lock
+    // and read under a shared one; the generation goes up with every change so that the others know to look again
+    class Catalogue
+    {
+    public:
+        class Header
+        {
+        public:
+            char Magic[4];
+
+            std::uint32_t Version;
+
+            std::uint32_t RecordSize;
+
+            std::uint32_t Capacity;
+
+            // records in use or freed, new records go after them
+            std::uint32_t Count;
+
+            std::uint32_t Reserved;
+
+            std::uint64_t Generation;
+
+            std::int64_t DirectoryTime;
+        };
+
+        class Record
+        {
+        public:
+            char File[96];
+
+            char Name[64];
+
+            std::int64_t Epoch;
+
+            std::int64_t Time;
+
+            std::int64_t Size;
+
+            std::int32_t Section;
+
+            std::int32_t Life;
+
+            std::int32_t Money;
+
+            std::int32_t Items;
+
+            std::int32_t Codewords;
+
+            std::uint8_t Summarised;
+
+            // 0 for a record freed when its save went away
+            std::uint8_t Used;
+
+            std::uint8_t Padding[2];
+        };
+
+        static_assert(sizeof(SaveIndex::Catalogue::Header) == 40 && sizeof(SaveIndex::Catalogue::Record) == 208, "the catalogue is shared between builds, its layout cannot change without a new version");
+
+        int Descriptor = -1;
+
+        unsigned char *Map = NULL;
+
+        std::size_t Mapped = 0;
+
+        // generation of the catalogue the last time it was read
+        std::uint64_t Generation = 0;
+
+        Catalogue()
+        {
+        }
+
+        ~Catalogue()
+        {
+            CLOSE();
+        }
+
+        Catalogue(const SaveIndex::Catalogue &) = delete;
+
+        SaveIndex::Catalogue &operator=(const SaveIndex::Catalogue &) = delete;
+
+        SaveIndex::Catalogue::Header *HEADER()
+        {
+            return (SaveIndex::Catalogue::Header *)Map;
+        }
+
+        SaveIndex::Catalogue::Record *RECORD(std::size_t record)
+        {
+            return (SaveIndex::Catalogue::Record *)(Map + sizeof(SaveIndex::Catalogue::Header)) + record;
+        }
+
+        static std::size_t BYTES(std::size_t capacity)
+        {
+            return sizeof(SaveIndex::Catalogue::Header) + capacity * sizeof(SaveIndex::Catalogue::Record);
+        }
+
+        // maps the file again if another copy of the game made it larger
+        bool REMAP()
+        {
+#if !defined(_WIN32)
+            struct stat status;
+
+            if (fstat(Descriptor, &status) != 0)
+            {
+                return false;
+            }
+
+            if ((std::size_t)status.st_size == Mapped && Map)
+            {
+                return true;
+            }
+
+            if (Map)
+            {
+                munmap(Map, Mapped);
+            }
+
+            Map = NULL;
+
+            Mapped = 0;
+
+            if ((std::size_t)status.st_size < sizeof(SaveIndex::Catalogue::Header))
+            {
+                return false;
+            }
+
+            auto map = mmap(NULL, status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, Descriptor, 0);
+
+            if (map == MAP_FAILED)
+            {
+                return false;
+            }
+
+            Map = (unsigned char *)map;
+
+            Mapped = status.st_size;
+
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        bool LOCK(bool exclusive)
+        {
+#if !defined(_WIN32)
+            if (Descriptor < 0 || flock(Descriptor, exclusive ? LOCK_EX : LOCK_SH) != 0)
+            {
+                return false;
+            }
+
+            if (!REMAP() || Mapped < Catalogue::BYTES(HEADER()->Capacity))
+            {
+                UNLOCK();
+
+                return false;
+            }
+
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        void UNLOCK()
+        {
+#if !defined(_WIN32)
+            flock(Descriptor, LOCK_UN);
+#endif
+        }
+
+        // with the exclusive lock held
+        bool GROW(std::uint32_t capacity)
+        {
+#if !defined(_WIN32)
+            if (ftruncate(Descriptor, Catalogue::BYTES(capacity)) != 0 || !REMAP())
+            {
+                return false;
+            }
+
+            HEADER()->Capacity = capacity;
+
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        // false where the catalogue cannot be shared, the index then keeps to its own file
+        bool OPEN(const std::string &file_name)
+        {
+            CLOSE();
+
+#if !defined(_WIN32)
+            Descriptor = open(file_name.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+            if (Descriptor < 0 || flock(Descriptor, LOCK_EX) != 0)
+            {
+                CLOSE();
+
+                return false;
+            }
+
+            REMAP();
+
+            auto header = HEADER();
+
+            // new, damaged or from another version: it only holds summaries, so it is started again
+            if (!Map || std::memcmp(header->Magic, SaveIndex::CATALOGUE_MAGIC, sizeof(SaveIndex::CATALOGUE_MAGIC)) != 0 || header->Version != SaveIndex::CATALOGUE_VERSION || header->RecordSize != sizeof(SaveIndex::Catalogue::Record) || header->Count > header->Capacity || Mapped < Catalogue::BYTES(header->Capacity))
+            {
+                auto generation = Map ? header->Generation : 0;
+
+                if (ftruncate(Descriptor, 0) != 0 || !GROW(64))
+                {
+                    UNLOCK();
+
+                    CLOSE();
+
+                    return false;
+                }
+
+                header = HEADER();
+
+                std::memcpy(header->Magic, SaveIndex::CATALOGUE_MAGIC, sizeof(SaveIndex::CATALOGUE_MAGIC));
+
+                header->Version = SaveIndex::CATALOGUE_VERSION;
+
+                header->RecordSize = sizeof(SaveIndex::Catalogue::Record);
+
+                header->Count = 0;
+
+                header->Generation = generation + 1;
+
+                header->DirectoryTime = 0;
+            }
+
+            UNLOCK();
+
+            Generation = 0;
+
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        void CLOSE()
+        {
+#if !defined(_WIN32)
+            if (Map)
+            {
+                munmap(Map, Mapped);
+            }
+
+            if (Descriptor >= 0)
+            {
+                close(Descriptor);
+            }
+#endif
+
+            Map = NULL;
+
+            Mapped = 0;
+
+            Descriptor = -1;
+
+            Generation = 0;
+        }
+
+        // file names too long for a record stay out of the catalogue, and so are read again by each copy of the game
+        static bool FITS(const std::string &file)
+        {
+            return file.size() < sizeof(SaveIndex::Catalogue::Record::File);
+        }
+
+        // with the exclusive lock held; false if the catalogue already knew better and kept its own record
+        bool PUT(const SaveIndex::Summary &summary)
+        {
+            if (!Catalogue::FITS(summary.File))
+            {
+                return true;
+            }
+
+            auto header = HEADER();
+
+            auto found = header->Count;
+
+            auto free = header->Count;
+
+            for (auto i = 0U; i < header->Count && found == header->Count; i++)
+            {
+                auto record = RECORD(i);
+
+                if (!record->Used)
+                {
+                    free = std::min(free, i);
+                }
+                else if (summary.File == record->File)
+                {
+                    found = i;
+                }
+            }
+
+            if (found == header->Count)
+            {
+                found = free;
+            }
+            else if (RECORD(found)->Summarised && !summary.Summarised && RECORD(found)->Time == summary.Time && RECORD(found)->Size == summary.Size)
+            {
+                // another copy of the game already read this very save
+                return false;
+            }
+
+            if (found >= header->Capacity)
+            {
+                if (!GROW(header->Capacity * 2))
+                {
+                    return true;
+                }
+
+                header = HEADER();
+            }
+
+            if (found == header->Count)
+            {
+                header->Count++;
+            }
+
+            auto record = RECORD(found);
+
+            std::memset(record, 0, sizeof(SaveIndex::Catalogue::Record));
+
+            std::strncpy(record->File, summary.File.c_str(), sizeof(record->File) - 1);
+
+            std::strncpy(record->Name, summary.Name.c_str(), sizeof(record->Name) - 1);
+
+            record->Epoch = summary.Epoch;
+
+            record->Time = summary.Time;
+
+            record->Size = summary.Size;
+
+            record->Section = summary.Section;
+
+            record->Life = summary.Life;
+
+            record->Money = summary.Money;
+
+            record->Items = summary.Items;
+
+            record->Codewords = summary.Codewords;
+
+            record->Summarised = summary.Summarised ? 1 : 0;
+
+            record->Used = 1;
+
+            return true;
+        }
+
+        // with the exclusive lock held
+        void ERASE(const std::string &file)
+        {
+            auto header = HEADER();
+
+            for (auto i = 0U; i < header->Count; i++)
+            {
+                auto record = RECORD(i);
+
+                if (record->Used && file == record->File)
+                {
+                    record->Used = 0;
+                }
+            }
+        }
+
+        // with a lock held
+        SaveIndex::Summary SUMMARY(std::size_t index)
+        {
+            auto record = RECORD(index);
+
+            auto summary = SaveIndex::Summary();
+
+            summary.File = std::string(record->File, strnlen(record->File, sizeof(record->File)));
+
+            summary.Name = std::string(record->Name, strnlen(record->Name, sizeof(record->Name)));
+
+            summary.Epoch = record->Epoch;
+
+            summary.Time = record->Time;
+
+            summary.Size = record->Size;
+
+            summary.Section = record->Section;
+
+            summary.Life = record->Life;
+
+            summary.Money = record->Money;
+
+            summary.Items = record->Items;
+
+            summary.Codewords = record->Codewords;
+
+            summary.Summarised = record->Summarised != 0;
+
+            return summary;
+        }
+    };
+
+    class Index
+    {
+    public:
+        std::string Directory = std::string();
+
+        // by file name
+        std::map<std::string, SaveIndex::Summary> Records = std::map<std::string, SaveIndex::Summary>();
+
+        // write time of the directory when Records last matched its contents
+        long long DirectoryTime = 0;
+
+        // Records differ from what is on disk
+        bool Dirty = false;
+
+        SaveIndex::Watcher Watcher;
+
+        SaveIndex::Catalogue Catalogue;
+
+        // files whose records changed since they were last put in the catalogue
+        std::set<std::string> Changed = std::set<std::string>();
+
+        // most recently written first, rebuilt only after Records change
+        std::vector<std::string> Files = std::vector<std::string>();
+
+        bool Stale = true;
+
+        std::string PATH()
+        {
+            return (std::filesystem::path(Directory) / SaveIndex::FILE_NAME).string();
+        }
+
+        // switches to the index of another directory, reading it if there is one, and brings it up to date with the saves
+        void OPEN(const std::string &directory)
+        {
+            if (directory == Directory)
+            {
+                return;
+            }
+
+            Directory = directory;
+
+            Records.clear();
+
+            DirectoryTime = 0;
+
+            Dirty = false;
+
+            Stale = true;
+
+            Changed.clear();
+
+            // watched before the scan so that nothing written meanwhile is missed
+            Watcher.WATCH(directory);
+
+            Catalogue.OPEN((std::filesystem::path(directory) / SaveIndex::CATALOGUE).string());
+
+            READ();
+
+            SCAN();
+        }
+
+        // takes the records from the catalogue if another copy of the game changed it since it was last read
+        void SYNC()
+        {
+            if (!Catalogue.LOCK(false))
+            {
+                return;
+            }
+
+            auto header = Catalogue.HEADER();
+
+            if (header->Generation != Catalogue.Generation)
+            {
+                auto records = std::map<std::string, SaveIndex::Summary>();
+
+                for (auto i = 0U; i < header->Count; i++)
+                {
+                    if (Catalogue.RECORD(i)->Used)
+                    {
+                        auto summary = Catalogue.SUMMARY(i);
+
+                        records[summary.File] = summary;
+                    }
+                }
+
+                // saves the catalogue has no room for are kept as they are
+                for (auto &record : Records)
+                {
+                    if (!SaveIndex::Catalogue::FITS(record.first))
+                    {
+                        records[record.first] = record.second;
+                    }
+                }
+
+                Records = records;
+
+                DirectoryTime = header->DirectoryTime;
+
+                Catalogue.Generation = header->Generation;
+
+                Stale = true;
+            }
+
+            Catalogue.UNLOCK();
+        }
+
+        // the summaries kept from last time, unless the index is damaged
+        void READ()
+        {
+            if (Catalogue.Map)
+            {
+                SYNC();
+
+                return;
+            }
+
+            std::ifstream ifs(PATH(), std::ios::binary);
+
+            auto bytes = std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+
+            auto header = sizeof(SaveIndex::MAGIC) - 1;
+
+            if (bytes.size() < header + 1 || bytes.compare(0, header, SaveIndex::MAGIC) != 0 || bytes[header] != SaveIndex::VERSION)
+            {
+                return;
+            }
+
+            auto reader = Binary::Reader((const std::uint8_t *)bytes.data() + header + 1, bytes.size() - header - 1);
+
+            auto time = reader.INT();
+
+            auto count = reader.UNSIGNED();
+
+            auto records = std::map<std::string, SaveIndex::Summary>();
+
+            for (auto i = 0ULL; i < count && reader.Good; i++)
+            {
+                auto summary = SaveIndex::Summary();
+
+                summary.File = reader.STRING();
+
+                summary.Epoch = reader.INT();
+
+                summary.Name = reader.STRING();
+
+                summary.Section = (int)reader.INT();
+
+                summary.Life = (int)reader.INT();
+
+                summary.Money = (int)reader.INT();
+
+                summary.Items = (int)reader.INT();
+
+                summary.Codewords = (int)reader.INT();
+
+                summary.Time = reader.INT();
+
+                summary.Size = reader.INT();
+
+                summary.Summarised = reader.BYTE() != 0;
+
+                records[summary.File] = summary;
+            }
+
+            // a damaged or cut short index is rebuilt from the saves themselves
+            if (reader.Good && reader.END())
+            {
+                Records = records;
+
+                DirectoryTime = time;
+            }
+        }
+
+        // writes the index if anything changed, over the old one so that the directory itself is left untouched;
+        // in the catalogue only the records that changed are written, so that those of other copies of the game are kept
+        bool SAVE()
+        {
+            if (!Dirty || Directory.empty())
+            {
+                return true;
+            }
+
+            if (Catalogue.Map)
+            {
+                if (!Catalogue.LOCK(true))
+                {
+                    return false;
+                }
+
+                auto header = Catalogue.HEADER();
+
+                // whatever other copies wrote in between still has to be read
+                auto current = header->Generation == Catalogue.Generation;
+
+                for (auto &file : Changed)
+                {
+                    auto record = Records.find(file);
+
+                    if (record != Records.end())
+                    {
+                        current &= Catalogue.PUT(record->second);
+                    }
+                    else
+                    {
+                        Catalogue.ERASE(file);
+                    }
+                }
+
+                header = Catalogue.HEADER();
+
+                header->DirectoryTime = DirectoryTime;
+
+                header->Generation++;
+
+                if (current)
+                {
+                    Catalogue.Generation = header->Generation;
+                }
+
+                Catalogue.UNLOCK();
+
+                Changed.clear();
+
+                Dirty = false;
+
+                return true;
+            }
+
+            auto writer = Binary::Writer();
+
+            writer.Bytes.append(SaveIndex::MAGIC, sizeof(SaveIndex::MAGIC) - 1);
+
+            writer.BYTE(SaveIndex::VERSION);
+
+            writer.INT(DirectoryTime);
+
+            writer.UNSIGNED(Records.size());
+
+            for (auto &record : Records)
+            {
+                auto &summary = record.second;
+
+                writer.STRING(summary.File.c_str());
+
+                writer.INT(summary.Epoch);
+
+                writer.STRING(summary.Name.c_str());
+
+                writer.INT(summary.Section);
+
+                writer.INT(summary.Life);
+
+                writer.INT(summary.Money);
+
+                writer.INT(summary.Items);
+
+                writer.INT(summary.Codewords);
+
+                writer.INT(summary.Time);
+
+                writer.INT(summary.Size);
+
+                writer.BYTE(summary.Summarised ? 1 : 0);
+            }
+
+            std::ofstream ofs(PATH(), std::ios::binary | std::ios::trunc);
+
+            ofs.write(writer.Bytes.data(), writer.Bytes.size());
+
+            ofs.close();
+
+            Dirty = !ofs.good();
+
+            return !Dirty;
+        }
+
+        // brings the list of saves up to date, which only needs the directory read when files were added or removed
+        void SCAN()
+        {
+            auto error = std::error_code();
+
+            auto directory_time = (long long)std::filesystem::last_write_time(Directory, error).time_since_epoch().count();
+
+            if (error || directory_time == DirectoryTime)
+            {
+                return;
+            }
+
+            auto records = std::map<std::string, SaveIndex::Summary>();
+
+            for (auto entry = std::filesystem::directory_iterator(Directory, error); !error && entry != std::filesystem::directory_iterator(); entry.increment(error))
+            {
+                auto path = entry->path();
+
+                if (!SaveIndex::IsSave(path))
+                {
+                    continue;
+                }
+
+                auto file = path.filename().string();
+
+                auto summary = SaveIndex::Summary();
+
+                if (!SaveIndex::STAMP(path, summary.Time, summary.Size))
+                {
+                    continue;
+                }
+
+                auto record = Records.find(file);
+
+                if (record != Records.end() && record->second.Time == summary.Time && record->second.Size == summary.Size)
+                {
+                    summary = record->second;
+                }
+
+                summary.File = file;
+
+                if (record == Records.end() || record->second.Time != summary.Time || record->second.Size != summary.Size)
+                {
+                    Changed.insert(file);
+                }
+
+                records[file] = summary;
+            }
+
+            for (auto &record : Records)
+            {
+                if (records.count(record.first) == 0)
+                {
+                    Changed.insert(record.first);
+                }
+            }
+
+            Records = records;
+
+            DirectoryTime = directory_time;
+
+            Dirty = true;
+
+            Stale = true;
+        }
+
+        // looks at a single save again after it was written, renamed or deleted
+        void REFRESH(const std::string &file)
+        {
+            auto summary = SaveIndex::Summary();
+
+            if (!SaveIndex::STAMP(std::filesystem::path(Directory) / file, summary.Time, summary.Size))
+            {
+                if (Records.erase(file) == 0)
+                {
+                    return;
+                }
+            }
+            else
+            {
+                auto &record = Records[file];
+
+                if (record.Time == summary.Time && record.Size == summary.Size)
+                {
+                    return;
+                }
+
+                summary.File = file;
+
+                record = summary;
+            }
+
+            Changed.insert(file);
+
+            Dirty = true;
+
+            Stale = true;
+        }
+
+        // applies what the watcher saw, the directory is read in full only when it could not keep up or is not there
+        void POLL()
+        {
+            // what other copies of the game wrote first, so that their saves are not looked at again
+            if (Catalogue.Map)
+            {
+                SAVE();
+
+                SYNC();
+            }
+
+            auto changes = std::vector<std::string>();
+
+            if (Watcher.CHANGES(changes))
+            {
+                for (auto i = 0; i < changes.size(); i++)
+                {
+                    REFRESH(changes[i]);
+                }
+            }
+            else
+            {
+                if (Watcher.Notify >= 0)
+                {
+                    DirectoryTime = 0;
+                }
+
+                SCAN();
+            }
+        }
+
+        // paths of the saves, most recently written first; stays valid until the next call
+        const std::vector<std::string> &FILES()
+        {
+            POLL();
+
+            if (!Stale)
+            {
+                return Files;
+            }
+
+            auto summaries = std::vector<const SaveIndex::Summary *>();
+
+            for (auto &record : Records)
+            {
+                summaries.push_back(&record.second);
+            }
+
+            std::stable_sort(summaries.begin(), summaries.end(), [](const SaveIndex::Summary *a, const SaveIndex::Summary *b)
+                             { return a->Time > b->Time; });
+
+            Files.clear();
+
+            for (auto i = 0; i < summaries.size(); i++)
+            {
+                Files.push_back((std::filesystem::path(Directory) / summaries[i]->File).string());
+            }
+
+            Stale = false;
+
+            return Files;
+        }
+
+        // the summary of a save if it is still that of the file on disk, NULL if the save has to be read again
+        const SaveIndex::Summary *GET(const std::string &path)
+        {
+            auto record = Records.find(std::filesystem::path(path).filename().string());
+
+            auto time = 0LL;
+
+            auto size = 0LL;
+
+            if (record == Records.end() || !record->second.Summarised || !SaveIndex::STAMP(path, time, size) || time != record->second.Time || size != record->second.Size)
+            {
+                return NULL;
+            }
+
+            return &record->second;
+        }
+
+        // records what was just read from or written to a save
+        const SaveIndex::Summary &UPDATE(const std::string &path, const Character::Base &player)
+        {
+            auto file = std::filesystem::path(path).filename().string();
+
+            auto &summary = Records[file];
+
+            summary.File = file;
+
+            summary.Epoch = player.Epoch;
+
+            summary.Name = player.Name;
+
+            summary.Section = player.StoryID;
+
+            summary.Life = player.Life;
+
+            summary.Money = player.Money;
+
+            summary.Items = player.Items.size();
+
+            summary.Codewords = player.Codewords.size();
+
+            summary.Summarised = SaveIndex::STAMP(path, summary.Time, summary.Size);
+
+            Changed.insert(file);
+
+            Dirty = true;
+
+            Stale = true;
+
+            return summary;
+        }
+    };
+
+    // thumbnails of the saves on screen, read on a thread of their own and kept for the most recently shown saves only
+    class Thumbnails
+    {
+    public:
+        // a decoded thumbnail, empty when the save has none
+        class Entry
+        {
+        public:
+            Thumbnail::Image Image = Thumbnail::Image();
+
+            // write time of the save it was read from
+            long long Time = 0;
+
+            std::list<std::string>::iterator Used;
+        };
+
+        std::mutex Lock;
+
+        std::condition_variable Wake;
+
+        // by path
+        std::map<std::string, SaveIndex::Thumbnails::Entry> Cache = std::map<std::string, SaveIndex::Thumbnails::Entry>();
+
+        // paths in Cache, most recently shown first
+        std::list<std::string> Recent = std::list<std::string>();
+
+        // saves on screen whose thumbnails are still to be read, with the write time the summary has for each
+        std::deque<std::pair<std::string, long long>> Wanted = std::deque<std::pair<std::string, long long>>();
+
+        // thumbnails kept before the least recently shown one is dropped
+        int Capacity = 64;
+
+        // called on the reading thread whenever another thumbnail is ready
+        std::function<void()> Ready;
+
+        bool Quit = false;
+
+        std::thread Worker;
+
+        Thumbnails()
+        {
+            Worker = std::thread(&SaveIndex::Thumbnails::RUN, this);
+        }
+
+        ~Thumbnails()
+        {
+            {
+                std::lock_guard<std::mutex> lock(Lock);
+
+                Quit = true;
+            }
+
+            Wake.notify_one();
+
+            Worker.join();
+        }
+
+        // the saves now on screen, whatever was asked for before and is not read yet is forgotten
+        void REQUEST(const std::vector<std::string> &paths, const std::vector<long long> &times)
+        {
+            {
+                std::lock_guard<std::mutex> lock(Lock);
+
+                Wanted.clear();
+
+                for (auto i = 0; i < paths.size() && i < times.size(); i++)
+                {
+                    auto entry = Cache.find(paths[i]);
+
+                    if (entry == Cache.end() || entry->second.Time != times[i])
+                    {
+                        Wanted.push_back({paths[i], times[i]});
+                    }
+                }
+            }
+
+            Wake.notify_one();
+        }
+
+        // copies out the thumbnail of a save as it was at the given write time, false if it has not been read yet
+        bool GET(const std::string &path, long long time, Thumbnail::Image &image)
+        {
+            std::lock_guard<std::mutex> lock(Lock);
+
+            auto entry = Cache.find(path);
+
+            if (entry == Cache.end() || entry->second.Time != time)
+            {
+                return false;
+            }
+
+            Recent.splice(Recent.begin(), Recent, entry->second.Used);
+
+            image = entry->second.Image;
+
+            return true;
+        }
+
+        void RUN()
+        {
+            auto lock = std::unique_lock<std::mutex>(Lock);
+
+            while (true)
+            {
+                Wake.wait(lock, [&]
+                          { return Quit || !Wanted.empty(); });
+
+                if (Quit)
+                {
+                    return;
+                }
+
+                auto wanted = Wanted.front();
+
+                Wanted.pop_front();
+
+                lock.unlock();
+
+                auto bytes = std::string();
+
+                auto image = Thumbnail::Image();
+
+                // JSON saves, autosaves and saves made before thumbnails have none, they are kept as empty so they are not read again
+                if (SaveFile::READ(wanted.first, bytes))
+                {
+                    if (SaveSlot::IsSlot(wanted.first))
+                    {
+                        SaveSlot::THUMBNAIL(bytes, image);
+                    }
+                    else
+                    {
+                        SaveFile::THUMBNAIL(bytes, image);
+                    }
+                }
+
+                lock.lock();
+
+                auto entry = Cache.find(wanted.first);
+
+                if (entry == Cache.end())
+                {
+                    Recent.push_front(wanted.first);
+
+                    entry = Cache.insert({wanted.first, SaveIndex::Thumbnails::Entry()}).first;
+                }
+                else
+                {
+                    Recent.splice(Recent.begin(), Recent, entry->second.Used);
+                }
+
+                entry->second.Image = std::move(image);
+
+                entry->second.Time = wanted.second;
+
+                entry->second.Used = Recent.begin();
+
+                while (Recent.size() > (std::size_t)std::max(1, Capacity))
+                {
+                    Cache.erase(Recent.back());
+
+                    Recent.pop_back();
+                }
+
+                if (Ready)
+                {
+                    Ready();
+                }
+            }
+        }
+    };
+
+} // namespace SaveIndex
+
+#endif
@@ -0,0 +1,376 @@
+#ifndef __SAVESLOT__HPP__
+#define __SAVESLOT__HPP__
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "binary.hpp"
+#include "character.hpp"
+#include "rewind.hpp"
+#include "savefile.hpp"
+#include "thumbnail.hpp"
+
+// Every save of one character in a single file, as a keyframe every so often and the fields that changed in between,
+// so a long campaign costs what the player changed rather than a whole save each time
+namespace SaveSlot
+{
+    const char MAGIC[] = "DML";
+
+    const int VERSION = 1;
+
+    const char EXTENSION[] = ".slot";
+
+    // magic, version, index size and index checksum
+    const int HEADER = sizeof(SaveSlot::MAGIC) - 1 + 1 + 4 + 4;
+
+    // saves between keyframes, so that reading any save applies fewer deltas than this
+    const int KEYFRAMES = 16;
+
+    bool IsSlot(const std::filesystem::path &path)
+    {
+        return path.extension() == SaveSlot::EXTENSION;
+    }
+
+    // one save in the slot: a keyframe holds every field of the character, a delta the fields that differ from the save before
+    class Entry
+    {
+    public:
+        decltype(Character::Base::Epoch) Epoch = 0;
+
+        int Section = -1;
+
+        bool Keyframe = true;
+
+        // where the record is among the slot's records
+        std::size_t Offset = 0;
+
+        std::size_t Length = 0;
+
+        std::uint32_t CRC = 0;
+    };
+
+    class Slot
+    {
+    public:
+        // oldest first
+        std::vector<SaveSlot::Entry> Entries = std::vector<SaveSlot::Entry>();
+
+        // every record, one after another
+        std::string Records = std::string();
+
+        // thumbnail of the latest save, as SaveFile::ATTACH writes it, empty when there is none
+        std::string Picture = std::string();
+
+        SaveFile::Status PARSE(const std::string &bytes)
+        {
+            auto magic = sizeof(SaveSlot::MAGIC) - 1;
+
+            if (bytes.size() < magic || bytes.compare(0, magic, SaveSlot::MAGIC) != 0)
+            {
+                return SaveFile::Status::NOT_BINARY;
+            }
+            else if (bytes.size() < SaveSlot::HEADER)
+            {
+                return SaveFile::Status::TRUNCATED;
+            }
+
+            auto header = Binary::Reader((const std::uint8_t *)bytes.data() + magic, SaveSlot::HEADER - magic);
+
+            auto version = header.BYTE();
+
+            auto size = (std::size_t)header.FIXED32();
+
+            auto crc = header.FIXED32();
+
+            if (version != SaveSlot::VERSION)
+            {
+                return SaveFile::Status::VERSION;
+            }
+            else if (bytes.size() - SaveSlot::HEADER < size)
+            {
+                return SaveFile::Status::TRUNCATED;
+            }
+            else if (Binary::CRC32((const std::uint8_t *)bytes.data() + SaveSlot::HEADER, size) != crc)
+            {
+                return SaveFile::Status::CHECKSUM;
+            }
+
+            auto index = Binary::Reader((const std::uint8_t *)bytes.data() + SaveSlot::HEADER, size);
+
+            auto count = index.UNSIGNED();
+
+            auto entries = std::vector<SaveSlot::Entry>();
+
+            auto offset = std::size_t(0);
+
+            for (auto i = 0ULL; i < count && index.Good; i++)
+            {
+                auto entry = SaveSlot::Entry();
+
+                entry.Epoch = index.INT();
+
+                entry.Section = (int)index.INT();
+
+                entry.Keyframe = index.BYTE() != 0;
+
+                entry.Length = (std::size_t)index.UNSIGNED();
+
+                entry.CRC = index.FIXED32();
+
+                entry.Offset = offset;
+
+                offset += entry.Length;
+
+                entries.push_back(entry);
+            }
+
+            if (!index.Good || !index.END() || (entries.size() > 0 && !entries[0].Keyframe))
+            {
+                return SaveFile::Status::MALFORMED;
+            }
+            else if (bytes.size() - SaveSlot::HEADER - size < offset)
+            {
+                return SaveFile::Status::TRUNCATED;
+            }
+
+            Entries = entries;
+
+            Records = bytes.substr(SaveSlot::HEADER + size, offset);
+
+            Picture = bytes.substr(SaveSlot::HEADER + size + offset);
+
+            return SaveFile::Status::OK;
+        }
+
+        std::string BYTES() const
+        {
+            auto index = Binary::Writer();
+
+            index.UNSIGNED(Entries.size());
+
+            for (auto i = 0; i < Entries.size(); i++)
+            {
+                index.INT(Entries[i].Epoch);
+
+                index.INT(Entries[i].Section);
+
+                index.BYTE(Entries[i].Keyframe ? 1 : 0);
+
+                index.UNSIGNED(Entries[i].Length);
+
+                index.FIXED32(Entries[i].CRC);
+            }
+
+            auto writer = Binary::Writer();
+
+            writer.Bytes.append(SaveSlot::MAGIC, sizeof(SaveSlot::MAGIC) - 1);
+
+            writer.BYTE(SaveSlot::VERSION);
+
+            writer.FIXED32(index.Bytes.size());
+
+            writer.FIXED32(Binary::CRC32((const std::uint8_t *)index.Bytes.data(), index.Bytes.size()));
+
+            writer.Bytes += index.Bytes;
+
+            writer.Bytes += Records;
+
+            writer.Bytes += Picture;
+
+            return writer.Bytes;
+        }
+
+        // the fields of a save: its keyframe with every delta up to it applied
+        SaveFile::Status FIELDS(int save, Rewind::Fields &fields) const
+        {
+            if (save < 0 || save >= Entries.size())
+            {
+                return SaveFile::Status::MALFORMED;
+            }
+
+            auto keyframe = save;
+
+            while (!Entries[keyframe].Keyframe)
+            {
+                keyframe--;
+            }
+
+            for (auto i = keyframe; i <= save; i++)
+            {
+                auto &entry = Entries[i];
+
+                auto record = Records.substr(entry.Offset, entry.Length);
+
+                if (Binary::CRC32((const std::uint8_t *)record.data(), record.size()) != entry.CRC)
+                {
+                    return SaveFile::Status::CHECKSUM;
+                }
+
+                fields = entry.Keyframe ? Rewind::UNPACK(record) : Rewind::PATCH(fields, record);
+            }
+
+            return SaveFile::Status::OK;
+        }
+
+        SaveFile::Status LOAD(int save, Character::Base &player) const
+        {
+            auto fields = Rewind::Fields();
+
+            auto status = FIELDS(save, fields);
+
+            if (status != SaveFile::Status::OK)
+            {
+                return status;
+            }
+
+            auto bytes = std::string();
+
+            for (auto i = 0; i < fields.size(); i++)
+            {
+                bytes += fields[i];
+            }
+
+            auto reader = Binary::Reader(bytes);
+
+            auto character = reader.CHARACTER();
+
+            if (!reader.Good || !reader.END())
+            {
+                return SaveFile::Status::MALFORMED;
+            }
+
+            player = character;
+
+            return SaveFile::Status::OK;
+        }
+
+        // whether the character is the one in the latest save, going by class and name
+        bool FOLLOWS(const Character::Base &player) const
+        {
+            auto latest = Character::Base();
+
+            if (Entries.size() == 0 || LOAD(Entries.size() - 1, latest) != SaveFile::Status::OK)
+            {
+                return false;
+            }
+
+            return latest.Type == player.Type && std::string(latest.Name) == player.Name;
+        }
+
+        // adds a save after the latest one, as a delta unless a keyframe is due or someone else's character is saved
+        // over the slot, whose saves then never depend on the records of the character before
+        bool APPEND(const Character::Base &player)
+        {
+            auto fields = Binary::Writer::FIELDS(player);
+
+            auto entry = SaveSlot::Entry();
+
+            entry.Epoch = player.Epoch;
+
+            entry.Section = player.StoryID;
+
+            entry.Keyframe = Entries.size() % SaveSlot::KEYFRAMES == 0 || !FOLLOWS(player);
+
+            auto record = std::string();
+
+            if (entry.Keyframe)
+            {
+                record = Rewind::PACK(fields);
+            }
+            else
+            {
+                auto last = Rewind::Fields();
+
+                if (FIELDS(Entries.size() - 1, last) != SaveFile::Status::OK)
+                {
+                    return false;
+                }
+
+                record = Rewind::DELTA(last, fields);
+            }
+
+            entry.Offset = Records.size();
+
+            entry.Length = record.size();
+
+            entry.CRC = Binary::CRC32((const std::uint8_t *)record.data(), record.size());
+
+            Records += record;
+
+            Entries.push_back(entry);
+
+            return true;
+        }
+    };
+
+    SaveFile::Status READ(const std::string &file_name, SaveSlot::Slot &slot)
+    {
+        auto bytes = std::string();
+
+        if (!SaveFile::READ(file_name, bytes))
+        {
+            return SaveFile::Status::UNREADABLE;
+        }
+
+        return slot.PARSE(bytes);
+    }
+
+    // a save from the slot, the latest one unless another is asked for
+    SaveFile::Status LOAD(const std::string &file_name, Character::Base &player, int save = -1)
+    {
+        auto slot = SaveSlot::Slot();
+
+        auto status = SaveSlot::READ(file_name, slot);
+
+        if (status != SaveFile::Status::OK)
+        {
+            return status;
+        }
+
+        return slot.LOAD(save < 0 ? (int)slot.Entries.size() - 1 : save, player);
+    }
+
+    // the thumbnail of the latest save in the slot
+    bool THUMBNAIL(const std::string &bytes, Thumbnail::Image &image)
+    {
+        auto slot = SaveSlot::Slot();
+
+        return slot.PARSE(bytes) == SaveFile::Status::OK && SaveFile::PICTURE(slot.Picture, 0, image);
+    }
+
+    // adds a save to a slot, starting the slot if there is none yet; a slot that cannot be read is left alone
+    bool APPEND(const std::string &file_name, const Character::Base &player, const Thumbnail::Image &thumbnail)
+    {
+        auto slot = SaveSlot::Slot();
+
+        auto error = std::error_code();
+
+        if (std::filesystem::exists(file_name, error) && SaveSlot::READ(file_name, slot) != SaveFile::Status::OK)
+        {
+            return false;
+        }
+
+        if (!slot.APPEND(player))
+        {
+            return false;
+        }
+
+        slot.Picture.clear();
+
+        SaveFile::ATTACH(slot.Picture, thumbnail);
+
+        return SaveFile::COMMIT(file_name, slot.BYTES());
+    }
+
+    // for SaveFile::Writer, which shrinks the screen to a thumbnail before calling it
+    bool WRITE(const SaveFile::Job &job)
+    {
+        return SaveSlot::APPEND(job.File, job.Player, job.Frame);
+    }
+
+} // namespace SaveSlot
+
+#endif
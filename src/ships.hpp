@@ -15,38 +15,71 @@ namespace Ship
         OCTAVIUS,
         PROVIDENCE,
         QUEENS_RANSOM,
-        SHIVERED_TIMBER
+        SHIVERED_TIMBER,
+        First = CALYPSO,
+        Last = SHIVERED_TIMBER
     };
 
     class Base
     {
     public:
-        std::string Name = "";
+        const char *Name = "";
         int Stars = 0;
         Ship::Type Type = Ship::Type::NONE;
 
-        Base()
+        constexpr Base() : Stars(1)
         {
-            Stars = 1;
         }
 
-        Base(const char *name, int stars, Ship::Type type)
+        constexpr Base(const char *name, int stars, Ship::Type type) : Name(name), Stars(stars), Type(type)
         {
-            Name = name;
-            Stars = stars;
-            Type = type;
         }
     };
 
-    auto NONE = Ship::Base("None", -1, Ship::Type::NONE);
-    auto LADY_OF_SHALOTT = Ship::Base("Lady of Shalott", 1, Ship::Type::LADY_OF_SHALOTT);
-    auto SHIVERED_TIMBER = Ship::Base("Shivered Timber", 2, Ship::Type::SHIVERED_TIMBER);
-    auto QUEENS_RANSOM = Ship::Base("Queen's Ransom", 3, Ship::Type::QUEENS_RANSOM);
-    auto FAERIE_QUEEN = Ship::Base("Faerie Queen", 3, Ship::Type::FAERIE_QUEEN);
-    auto METEOR = Ship::Base("Meteor", 4, Ship::Type::METEOR);
-    auto OCTAVIUS = Ship::Base("Octavius", 4, Ship::Type::OCTAVIUS);
-    auto PROVIDENCE = Ship::Base("Providence", 5, Ship::Type::PROVIDENCE);
-    auto CALYPSO = Ship::Base("Calypso", 5, Ship::Type::CALYPSO);
+    constexpr auto NONE = Ship::Base("None", -1, Ship::Type::NONE);
+    constexpr auto LADY_OF_SHALOTT = Ship::Base("Lady of Shalott", 1, Ship::Type::LADY_OF_SHALOTT);
+    constexpr auto SHIVERED_TIMBER = Ship::Base("Shivered Timber", 2, Ship::Type::SHIVERED_TIMBER);
+    constexpr auto QUEENS_RANSOM = Ship::Base("Queen's Ransom", 3, Ship::Type::QUEENS_RANSOM);
+    constexpr auto FAERIE_QUEEN = Ship::Base("Faerie Queen", 3, Ship::Type::FAERIE_QUEEN);
+    constexpr auto METEOR = Ship::Base("Meteor", 4, Ship::Type::METEOR);
+    constexpr auto OCTAVIUS = Ship::Base("Octavius", 4, Ship::Type::OCTAVIUS);
+    constexpr auto PROVIDENCE = Ship::Base("Providence", 5, Ship::Type::PROVIDENCE);
+    constexpr auto CALYPSO = Ship::Base("Calypso", 5, Ship::Type::CALYPSO);
+
+    // metadata table (names and full star ratings), indexed by Ship::Type
+    constexpr Ship::Base Catalogue[] = {Ship::CALYPSO, Ship::FAERIE_QUEEN, Ship::LADY_OF_SHALOTT, Ship::METEOR, Ship::OCTAVIUS, Ship::PROVIDENCE, Ship::QUEENS_RANSOM, Ship::SHIVERED_TIMBER};
+
+    constexpr bool VERIFY_CATALOGUE()
+    {
+        auto count = sizeof(Ship::Catalogue) / sizeof(Ship::Base);
+
+        auto verified = count == (int)Ship::Type::Last + 1;
+
+        for (auto i = 0; verified && i < count; i++)
+        {
+            verified = Ship::Catalogue[i].Type == static_cast<Ship::Type>(i);
+        }
+
+        return verified;
+    }
+
+    static_assert(Ship::VERIFY_CATALOGUE(), "every ship type needs its own entry in Ship::Catalogue, in enum order");
+
+    constexpr bool IsValid(Ship::Type ship)
+    {
+        return ship >= Ship::Type::First && ship <= Ship::Type::Last;
+    }
+
+    // full (undamaged) ship for this type, NONE if the type is unknown
+    constexpr Ship::Base LOOKUP(Ship::Type ship)
+    {
+        return Ship::IsValid(ship) ? Ship::Catalogue[(int)ship] : Ship::NONE;
+    }
+
+    constexpr int STARS(Ship::Type ship)
+    {
+        return Ship::IsValid(ship) ? Ship::Catalogue[(int)ship].Stars : 1;
+    }
 }
 
 #endif
@@ -1,9 +1,11 @@
 #ifndef __SKILLS__HPP__
 #define __SKILLS__HPP__
 
+#include <array>
 #include <vector>
 
 #include "items.hpp"
+#include "smallvector.hpp"
 
 namespace Skill
 {
@@ -21,7 +23,9 @@ namespace Skill
         SPELLS,
         STREETWISE,
         SWORDPLAY,
-        WILDERNESS_LORE
+        WILDERNESS_LORE,
+        First = AGILITY,
+        Last = WILDERNESS_LORE
     };
 
     class Base
@@ -29,42 +33,58 @@ namespace Skill
     public:
         const char *Name = NULL;
         const char *Description = NULL;
-        Skill::Type Type;
+        Skill::Type Type = Skill::Type::NONE;
         Item::Type Requirement = Item::Type::NONE;
 
-        Base(const char *name, const char *description, Skill::Type type, Item::Type item)
+        constexpr Base(const char *name, const char *description, Skill::Type type, Item::Type item) : Name(name), Description(description), Type(type), Requirement(item)
         {
-            Name = name;
-            Type = type;
-            Description = description;
-            Requirement = item;
         }
 
-        Base(const char *name, const char *description, Skill::Type type)
+        constexpr Base(const char *name, const char *description, Skill::Type type) : Name(name), Description(description), Type(type)
         {
-            Name = name;
-            Type = type;
-            Description = description;
-            Requirement = Item::Type::NONE;
         }
     };
 
-    auto AGILITY = Skill::Base("AGILITY", "The ability to perform acrobatic feats, run, climb, balance and leap. A character with this skill is nimble and dexterous.", Skill::Type::AGILITY);
-    auto BRAWLING = Skill::Base("BRAWLING", "Fisticuffs, wrestling holds, jabs and kicks, and the tricks of infighting. Not as effective as SWORDPLAY, but you do not need weapons - your own body is the weapon!", Skill::Type::BRAWLING);
-    auto CHARMS = Skill::Base("CHARMS", "The expert use of magical wards to protect you from danger. Also includes that most elusive of qualities: luck. You must possess a MAGIC AMULET to use this skill.", Skill::Type::CHARMS, Item::Type::MAGIC_AMULET);
-    auto CUNNING = Skill::Base("CUNNING", "The ability to think on your feet and devise clever schemes for getting out of trouble. Useful in countless situations.", Skill::Type::CUNNING);
-    auto FOLKLORE = Skill::Base("FOLKLORE", "Knowledge of myth and legend, and how best to deal with supernatural menaces such as garlic against vampires, silver bullets against a werewolf, and so on.", Skill::Type::FOLKLORE);
-    auto MARKSMANSHIP = Skill::Base("MARKSMANSHIP", "A long-range attack skill. You must possess a PISTOL to use this skill.", Skill::Type::MARKSMANSHIP, Item::Type::PISTOL);
-    auto ROGUERY = Skill::Base("ROGUERY", "The traditional repertoire of a thief's tricks: picking pockets, opening locks, and skulking unseen in the shadows.", Skill::Type::ROGUERY);
-    auto SEAFARING = Skill::Base("SEAFARING", "Knowing all about life at sea, including the ability to handle anything from a rowing boat right up to a large sailing ship.", Skill::Type::SEAFARING);
-    auto SPELLS = Skill::Base("SPELLS", "A range of magical effects encompassing illusions, elemental effects, commands, and summonings. You must possess a MAGIC WAND to use this skill.", Skill::Type::SPELLS, Item::Type::MAGIC_WAND);
-    auto STREETWISE = Skill::Base("STREETWISE", "With this skill you are never at a loss in towns and cities. What others see as the squalor and menace of narrow cobbed streets is home to you.", Skill::Type::STREETWISE);
-    auto SWORDPLAY = Skill::Base("SWORDPLAY", "The best fighting skill. You must possess a SWORD to use this skill.", Skill::Type::SWORDPLAY, Item::Type::SWORD);
-    auto WILDERNESS_LORE = Skill::Base("WILDERNESS LORE", "A talent for survival in the wild - whether it be forest, desert, swamp or mountain peak.", Skill::Type::WILDERNESS_LORE);
-
-    std::vector<Skill::Base> ALL = {Skill::AGILITY, Skill::BRAWLING, Skill::CHARMS, Skill::CUNNING, Skill::FOLKLORE, Skill::MARKSMANSHIP, Skill::ROGUERY, Skill::SEAFARING, Skill::SPELLS, Skill::STREETWISE, Skill::SWORDPLAY, Skill::WILDERNESS_LORE};
-
-    int FIND(std::vector<Skill::Base> &skills, Skill::Type skill)
+    // inline capacity covers the default skills limit
+    typedef SmallVector<Skill::Base, 4> List;
+
+    constexpr auto AGILITY = Skill::Base("AGILITY", "The ability to perform acrobatic feats, run, climb, balance and leap. A character with this skill is nimble and dexterous.", Skill::Type::AGILITY);
+    constexpr auto BRAWLING = Skill::Base("BRAWLING", "Fisticuffs, wrestling holds, jabs and kicks, and the tricks of infighting. Not as effective as SWORDPLAY, but you do not need weapons - your own body is the weapon!", Skill::Type::BRAWLING);
+    constexpr auto CHARMS = Skill::Base("CHARMS", "The expert use of magical wards to protect you from danger. Also includes that most elusive of qualities: luck. You must possess a MAGIC AMULET to use this skill.", Skill::Type::CHARMS, Item::Type::MAGIC_AMULET);
+    constexpr auto CUNNING = Skill::Base("CUNNING", "The ability to think on your feet and devise clever schemes for getting out of trouble. Useful in countless situations.", Skill::Type::CUNNING);
+    constexpr auto FOLKLORE = Skill::Base("FOLKLORE", "Knowledge of myth and legend, and how best to deal with supernatural menaces such as garlic against vampires, silver bullets against a werewolf, and so on.", Skill::Type::FOLKLORE);
+    constexpr auto MARKSMANSHIP = Skill::Base("MARKSMANSHIP", "A long-range attack skill. You must possess a PISTOL to use this skill.", Skill::Type::MARKSMANSHIP, Item::Type::PISTOL);
+    constexpr auto ROGUERY = Skill::Base("ROGUERY", "The traditional repertoire of a thief's tricks: picking pockets, opening locks, and skulking unseen in the shadows.", Skill::Type::ROGUERY);
+    constexpr auto SEAFARING = Skill::Base("SEAFARING", "Knowing all about life at sea, including the ability to handle anything from a rowing boat right up to a large sailing ship.", Skill::Type::SEAFARING);
+    constexpr auto SPELLS = Skill::Base("SPELLS", "A range of magical effects encompassing illusions, elemental effects, commands, and summonings. You must possess a MAGIC WAND to use this skill.", Skill::Type::SPELLS, Item::Type::MAGIC_WAND);
+    constexpr auto STREETWISE = Skill::Base("STREETWISE", "With this skill you are never at a loss in towns and cities. What others see as the squalor and menace of narrow cobbed streets is home to you.", Skill::Type::STREETWISE);
+    constexpr auto SWORDPLAY = Skill::Base("SWORDPLAY", "The best fighting skill. You must possess a SWORD to use this skill.", Skill::Type::SWORDPLAY, Item::Type::SWORD);
+    constexpr auto WILDERNESS_LORE = Skill::Base("WILDERNESS LORE", "A talent for survival in the wild - whether it be forest, desert, swamp or mountain peak.", Skill::Type::WILDERNESS_LORE);
+
+    // metadata table (names, descriptions and required items), indexed by Skill::Type
+    constexpr std::array<Skill::Base, (int)Skill::Type::Last + 1> ALL = {Skill::AGILITY, Skill::BRAWLING, Skill::CHARMS, Skill::CUNNING, Skill::FOLKLORE, Skill::MARKSMANSHIP, Skill::ROGUERY, Skill::SEAFARING, Skill::SPELLS, Skill::STREETWISE, Skill::SWORDPLAY, Skill::WILDERNESS_LORE};
+
+    constexpr bool VERIFY_ALL()
+    {
+        auto verified = true;
+
+        for (auto i = 0; verified && i < Skill::ALL.size(); i++)
+        {
+            verified = Skill::ALL[i].Type == static_cast<Skill::Type>(i) && Skill::ALL[i].Name != NULL && Skill::ALL[i].Description != NULL && (Skill::ALL[i].Requirement == Item::Type::NONE || Item::IsValid(Skill::ALL[i].Requirement));
+        }
+
+        return verified;
+    }
+
+    static_assert(Skill::VERIFY_ALL(), "every skill needs its own entry in Skill::ALL, in enum order");
+
+    constexpr bool IsValid(Skill::Type skill)
+    {
+        return skill >= Skill::Type::First && skill <= Skill::Type::Last;
+    }
+
+    template <typename T>
+    int FIND(T &skills, Skill::Type skill)
     {
         auto found = -1;
 
@@ -101,12 +121,14 @@ namespace Skill
         return found;
     }
 
-    bool VERIFY(std::vector<Skill::Base> &skills, Skill::Base skill)
+    template <typename T>
+    bool VERIFY(T &skills, Skill::Base skill)
     {
         return FIND(skills, skill.Type) >= 0;
     }
 
-    void ADD(std::vector<Skill::Base> &skills, Skill::Base skill)
+    template <typename T>
+    void ADD(T &skills, Skill::Base skill)
     {
         if (!VERIFY(skills, skill))
         {
@@ -114,7 +136,8 @@ namespace Skill
         }
     }
 
-    void REMOVE(std::vector<Skill::Base> &skills, Skill::Base skill)
+    template <typename T>
+    void REMOVE(T &skills, Skill::Base skill)
     {
         auto result = FIND(skills, skill.Type);
 
@@ -0,0 +1,415 @@
+#ifndef __SMALL_VECTOR__HPP__
+#define __SMALL_VECTOR__HPP__
+
+#include <cstddef>
+#include <cstdlib>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// vector-like container that keeps up to N elements inline and only moves to the heap when it outgrows them
+template <typename T, std::size_t N>
+class SmallVector
+{
+private:
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type Inline[N];
+
+    T *Heap = NULL;
+
+    std::size_t Size = 0;
+
+    std::size_t Capacity = N;
+
+    T *buffer()
+    {
+        return Heap ? Heap : reinterpret_cast<T *>(Inline);
+    }
+
+    const T *buffer() const
+    {
+        return Heap ? Heap : reinterpret_cast<const T *>(Inline);
+    }
+
+    void grow(std::size_t capacity)
+    {
+        if (capacity <= Capacity)
+        {
+            return;
+        }
+
+        if (capacity < Capacity * 2)
+        {
+            capacity = Capacity * 2;
+        }
+
+        auto heap = static_cast<T *>(::operator new(capacity * sizeof(T)));
+
+        auto data = buffer();
+
+        for (auto i = 0; i < Size; i++)
+        {
+            new (heap + i) T(std::move(data[i]));
+
+            data[i].~T();
+        }
+
+        if (Heap)
+        {
+            ::operator delete(Heap);
+        }
+
+        Heap = heap;
+
+        Capacity = capacity;
+    }
+
+    void release()
+    {
+        clear();
+
+        if (Heap)
+        {
+            ::operator delete(Heap);
+
+            Heap = NULL;
+        }
+
+        Capacity = N;
+    }
+
+    template <typename It>
+    void copy(It first, It last)
+    {
+        grow(Size + std::distance(first, last));
+
+        auto data = buffer();
+
+        for (auto it = first; it != last; it++)
+        {
+            new (data + Size) T(*it);
+
+            Size++;
+        }
+    }
+
+    void steal(SmallVector &src)
+    {
+        if (src.Heap)
+        {
+            Heap = src.Heap;
+
+            Size = src.Size;
+
+            Capacity = src.Capacity;
+
+            src.Heap = NULL;
+
+            src.Size = 0;
+
+            src.Capacity = N;
+        }
+        else
+        {
+            auto data = buffer();
+
+            for (auto i = 0; i < src.Size; i++)
+            {
+                new (data + i) T(std::move(src.buffer()[i]));
+            }
+
+            Size = src.Size;
+
+            src.clear();
+        }
+    }
+
+public:
+    typedef T value_type;
+    typedef T *iterator;
+    typedef const T *const_iterator;
+    typedef std::size_t size_type;
+
+    SmallVector()
+    {
+    }
+
+    SmallVector(std::initializer_list<T> list)
+    {
+        copy(list.begin(), list.end());
+    }
+
+    template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+    SmallVector(It first, It last)
+    {
+        copy(first, last);
+    }
+
+    explicit SmallVector(const std::vector<T> &list)
+    {
+        copy(list.begin(), list.end());
+    }
+
+    SmallVector(const SmallVector &src)
+    {
+        copy(src.begin(), src.end());
+    }
+
+    SmallVector(SmallVector &&src) noexcept
+    {
+        steal(src);
+    }
+
+    SmallVector &operator=(const SmallVector &src)
+    {
+        // self-assignment protection
+        if (this != &src)
+        {
+            clear();
+
+            copy(src.begin(), src.end());
+        }
+
+        return *this;
+    }
+
+    SmallVector &operator=(SmallVector &&src) noexcept
+    {
+        if (this != &src)
+        {
+            release();
+
+            steal(src);
+        }
+
+        return *this;
+    }
+
+    SmallVector &operator=(std::initializer_list<T> list)
+    {
+        clear();
+
+        copy(list.begin(), list.end());
+
+        return *this;
+    }
+
+    ~SmallVector()
+    {
+        release();
+    }
+
+    std::size_t size() const
+    {
+        return Size;
+    }
+
+    std::size_t capacity() const
+    {
+        return Capacity;
+    }
+
+    bool empty() const
+    {
+        return Size == 0;
+    }
+
+    // true while the elements still live in the inline buffer
+    bool inlined() const
+    {
+        return Heap == NULL;
+    }
+
+    T *data()
+    {
+        return buffer();
+    }
+
+    const T *data() const
+    {
+        return buffer();
+    }
+
+    T *begin()
+    {
+        return buffer();
+    }
+
+    T *end()
+    {
+        return buffer() + Size;
+    }
+
+    const T *begin() const
+    {
+        return buffer();
+    }
+
+    const T *end() const
+    {
+        return buffer() + Size;
+    }
+
+    T &operator[](std::size_t index)
+    {
+        return buffer()[index];
+    }
+
+    const T &operator[](std::size_t index) const
+    {
+        return buffer()[index];
+    }
+
+    T &front()
+    {
+        return buffer()[0];
+    }
+
+    T &back()
+    {
+        return buffer()[Size - 1];
+    }
+
+    const T &front() const
+    {
+        return buffer()[0];
+    }
+
+    const T &back() const
+    {
+        return buffer()[Size - 1];
+    }
+
+    void reserve(std::size_t capacity)
+    {
+        grow(capacity);
+    }
+
+    void push_back(const T &item)
+    {
+        if (Size == Capacity)
+        {
+            // copy first in case item lives inside this container
+            auto temp = T(item);
+
+            grow(Size + 1);
+
+            new (buffer() + Size) T(std::move(temp));
+        }
+        else
+        {
+            new (buffer() + Size) T(item);
+        }
+
+        Size++;
+    }
+
+    void push_back(T &&item)
+    {
+        grow(Size + 1);
+
+        new (buffer() + Size) T(std::move(item));
+
+        Size++;
+    }
+
+    void pop_back()
+    {
+        if (Size > 0)
+        {
+            Size--;
+
+            buffer()[Size].~T();
+        }
+    }
+
+    T *erase(const T *first, const T *last)
+    {
+        auto data = buffer();
+
+        auto start = first - data;
+
+        auto count = last - first;
+
+        if (count > 0)
+        {
+            for (auto i = start; i + count < Size; i++)
+            {
+                data[i] = std::move(data[i + count]);
+            }
+
+            for (auto i = 0; i < count; i++)
+            {
+                pop_back();
+            }
+        }
+
+        return buffer() + start;
+    }
+
+    T *erase(const T *position)
+    {
+        return erase(position, position + 1);
+    }
+
+    template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+    T *insert(const T *position, It first, It last)
+    {
+        auto index = position - buffer();
+
+        auto count = std::distance(first, last);
+
+        if (count > 0)
+        {
+            // stage the new elements at the end then rotate them into place
+            auto temp = SmallVector(first, last);
+
+            grow(Size + count);
+
+            auto data = buffer();
+
+            for (auto i = 0; i < count; i++)
+            {
+                new (data + Size) T(std::move(temp[i]));
+
+                Size++;
+            }
+
+            for (auto i = 0; i < count; i++)
+            {
+                for (auto j = Size - count + i; j > index + i; j--)
+                {
+                    std::swap(data[j], data[j - 1]);
+                }
+            }
+        }
+
+        return buffer() + index;
+    }
+
+    T *insert(const T *position, const T &item)
+    {
+        return insert(position, &item, &item + 1);
+    }
+
+    void clear()
+    {
+        auto data = buffer();
+
+        for (auto i = 0; i < Size; i++)
+        {
+            data[i].~T();
+        }
+
+        Size = 0;
+    }
+
+    std::vector<T> vector() const
+    {
+        return std::vector<T>(begin(), end());
+    }
+};
+
+#endif
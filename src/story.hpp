@@ -3,150 +3,12 @@
 
 #include <vector>
 
-#include "constants.hpp"
-#include "controls.hpp"
 #include "codewords.hpp"
 #include "items.hpp"
 #include "skills.hpp"
 #include "character.hpp"
-
-namespace Choice
-{
-    enum class Type
-    {
-        NORMAL = 0, // No requirements
-        ITEMS,
-        GET_ITEMS,
-        SKILL,
-        CODEWORD,
-        MONEY,
-        LIFE,
-        ANY_ITEM,
-        ANY_SKILL,
-        SKILL_ITEM,
-        SKILL_ANY,
-        SKILL_ALL,
-        FIRE_WEAPON,
-        LOSE_ITEMS,
-        LOSE_MONEY,
-        LOSE_ALL,
-        LOSE_SKILLS,
-        GET_CODEWORD,
-        LOSE_CODEWORD,
-        GAIN_MONEY,
-        GIVE,
-        BRIBE,
-        TAKE,
-        PAY_WITH,
-        SELL
-    };
-
-    class Base
-    {
-    public:
-        const char *Text = NULL;
-
-        Choice::Type Type = Choice::Type::NORMAL;
-
-        Skill::Type Skill = Skill::Type::NONE;
-
-        std::vector<Item::Base> Items = std::vector<Item::Base>();
-
-        Codeword::Type Codeword = Codeword::Type::NONE;
-
-        int Value = 0;
-
-        int Destination = -1;
-
-        Base(const char *text, int destination)
-        {
-            Text = text;
-            Destination = destination;
-        }
-
-        Base(const char *text, int destination, Skill::Type skill, std::vector<Item::Base> items)
-        {
-            Text = text;
-            Destination = destination;
-            Type = Choice::Type::SKILL_ITEM;
-            Items = items;
-            Skill = skill;
-        }
-
-        Base(const char *text, int destination, std::vector<Item::Base> items)
-        {
-            Text = text;
-            Destination = destination;
-            Type = Choice::Type::ITEMS;
-            Items = items;
-        }
-
-        Base(const char *text, int destination, Skill::Type skill)
-        {
-            Text = text;
-            Destination = destination;
-            Type = Choice::Type::SKILL;
-            Skill = skill;
-        }
-
-        Base(const char *text, int destination, Codeword::Type codeword)
-        {
-            Text = text;
-            Destination = destination;
-            Type = Choice::Type::CODEWORD;
-            Codeword = codeword;
-        }
-
-        Base(const char *text, int destination, Choice::Type type, int value)
-        {
-            Text = text;
-            Destination = destination;
-            Type = type;
-            Value = value;
-        }
-
-        Base(const char *text, int destination, Choice::Type type)
-        {
-            Text = text;
-            Destination = destination;
-            Type = type;
-        }
-
-        Base(const char *text, int destination, Choice::Type type, std::vector<Item::Base> items)
-        {
-            Text = text;
-            Destination = destination;
-            Type = type;
-            Items = items;
-        }
-
-        Base(const char *text, int destination, Choice::Type type, Skill::Type skill, std::vector<Item::Base> items)
-        {
-            Text = text;
-            Destination = destination;
-            Type = type;
-            Skill = skill;
-            Items = items;
-        }
-
-        Base(const char *text, int destination, Choice::Type type, std::vector<Item::Base> items, int value)
-        {
-            Text = text;
-            Destination = destination;
-            Type = type;
-            Items = items;
-            Value = value;
-        }
-
-        Base(const char *text, int destination, Choice::Type type, Codeword::Type codeword)
-        {
-            Text = text;
-            Destination = destination;
-            Type = type;
-            Codeword = codeword;
-        }
-    };
-} // namespace Choice
+#include "choices.hpp"
+#include "storygraph.hpp"
 
 namespace Story
 {
@@ -191,10 +53,10 @@ namespace Story
         std::pair<Item::Base, Item::Base> Trade;
 
         // Player selects items to take up to a certain limit
-        std::vector<Item::Base> Take = std::vector<Item::Base>();
+        Item::List Take = Item::List();
 
         // Player selects items to lose
-        std::vector<Item::Base> ToLose = std::vector<Item::Base>();
+        Item::List ToLose = Item::List();
 
         int Limit = 0;
 
@@ -236,150 +98,6 @@ namespace Story
         }
     };
 
-    std::vector<Button> StandardControls(bool compact = false)
-    {
-        auto idx = 0;
-
-        auto controls = std::vector<Button>();
-
-        if (!compact)
-        {
-            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
-            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
-
-            idx = 2;
-        }
-
-        controls.push_back(Button(idx, "icons/map.png", idx, idx + 1, compact ? idx : 1, idx, startx, buttony, Control::Type::MAP));
-        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, compact ? idx + 1 : 1, idx + 1, startx + gridsize, buttony, Control::Type::GAME));
-        controls.push_back(Button(idx + 2, "icons/user.png", idx + 1, idx + 3, compact ? idx + 2 : 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::CHARACTER));
-        controls.push_back(Button(idx + 3, "icons/items.png", idx + 2, idx + 4, compact ? idx + 3 : 1, idx + 3, startx + 3 * gridsize, buttony, Control::Type::USE));
-        controls.push_back(Button(idx + 4, "icons/next.png", idx + 3, idx + 5, compact ? idx + 4 : 1, idx + 4, startx + 4 * gridsize, buttony, Control::Type::NEXT));
-        controls.push_back(Button(idx + 5, "icons/exit.png", idx + 4, idx + 5, compact ? idx + 5 : 1, idx + 5, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        return controls;
-    }
-
-    std::vector<Button> ShopControls(bool compact = false)
-    {
-        auto idx = 0;
-
-        auto controls = std::vector<Button>();
-
-        if (!compact)
-        {
-            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
-            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
-
-            idx = 2;
-        }
-
-        controls.push_back(Button(idx, "icons/map.png", idx, idx + 1, compact ? idx : 1, idx, startx, buttony, Control::Type::MAP));
-        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, compact ? idx + 1 : 1, idx + 1, startx + gridsize, buttony, Control::Type::GAME));
-        controls.push_back(Button(idx + 2, "icons/user.png", idx + 1, idx + 3, compact ? idx + 2 : 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::CHARACTER));
-        controls.push_back(Button(idx + 3, "icons/items.png", idx + 2, idx + 4, compact ? idx + 3 : 1, idx + 3, startx + 3 * gridsize, buttony, Control::Type::USE));
-        controls.push_back(Button(idx + 4, "icons/next.png", idx + 3, idx + 5, compact ? idx + 4 : 1, idx + 4, startx + 4 * gridsize, buttony, Control::Type::NEXT));
-        controls.push_back(Button(idx + 5, "icons/shop.png", idx + 4, idx + 6, compact ? idx + 5 : 1, idx + 5, startx + 5 * gridsize, buttony, Control::Type::SHOP));
-        controls.push_back(Button(idx + 6, "icons/exit.png", idx + 5, idx + 6, compact ? idx + 6 : 1, idx + 6, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        return controls;
-    }
-
-    std::vector<Button> SellControls(bool compact = false)
-    {
-        auto idx = 0;
-
-        auto controls = std::vector<Button>();
-
-        if (!compact)
-        {
-            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
-            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
-
-            idx = 2;
-        }
-
-        controls.push_back(Button(idx, "icons/map.png", idx, idx + 1, compact ? idx : 1, idx, startx, buttony, Control::Type::MAP));
-        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, compact ? idx + 1 : 1, idx + 1, startx + gridsize, buttony, Control::Type::GAME));
-        controls.push_back(Button(idx + 2, "icons/user.png", idx + 1, idx + 3, compact ? idx + 2 : 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::CHARACTER));
-        controls.push_back(Button(idx + 3, "icons/items.png", idx + 2, idx + 4, compact ? idx + 3 : 1, idx + 3, startx + 3 * gridsize, buttony, Control::Type::USE));
-        controls.push_back(Button(idx + 4, "icons/next.png", idx + 3, idx + 5, compact ? idx + 4 : 1, idx + 4, startx + 4 * gridsize, buttony, Control::Type::NEXT));
-        controls.push_back(Button(idx + 5, "icons/selling.png", idx + 4, idx + 6, compact ? idx + 5 : 1, idx + 5, startx + 5 * gridsize, buttony, Control::Type::SELL));
-        controls.push_back(Button(idx + 6, "icons/exit.png", idx + 5, idx + 6, compact ? idx + 6 : 1, idx + 6, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        return controls;
-    }
-
-    std::vector<Button> BuyAndSellControls(bool compact = false)
-    {
-        auto idx = 0;
-
-        auto controls = std::vector<Button>();
-
-        if (!compact)
-        {
-            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
-            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
-
-            idx = 2;
-        }
-
-        controls.push_back(Button(idx, "icons/map.png", idx, idx + 1, compact ? idx : 1, idx, startx, buttony, Control::Type::MAP));
-        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, compact ? idx + 1 : 1, idx + 1, startx + gridsize, buttony, Control::Type::GAME));
-        controls.push_back(Button(idx + 2, "icons/user.png", idx + 1, idx + 3, compact ? idx + 2 : 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::CHARACTER));
-        controls.push_back(Button(idx + 3, "icons/items.png", idx + 2, idx + 4, compact ? idx + 3 : 1, idx + 3, startx + 3 * gridsize, buttony, Control::Type::USE));
-        controls.push_back(Button(idx + 4, "icons/next.png", idx + 3, idx + 5, compact ? idx + 4 : 1, idx + 4, startx + 4 * gridsize, buttony, Control::Type::NEXT));
-        controls.push_back(Button(idx + 5, "icons/shop.png", idx + 4, idx + 6, compact ? idx + 5 : 1, idx + 5, startx + 5 * gridsize, buttony, Control::Type::SHOP));
-        controls.push_back(Button(idx + 6, "icons/selling.png", idx + 5, idx + 7, compact ? idx + 6 : 1, idx + 6, startx + 6 * gridsize, buttony, Control::Type::SELL));
-        controls.push_back(Button(idx + 7, "icons/exit.png", idx + 6, idx + 7, compact ? idx + 7 : 1, idx + 7, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        return controls;
-    }
-
-    std::vector<Button> TradeControls(bool compact = false)
-    {
-        auto idx = 0;
-
-        auto controls = std::vector<Button>();
-
-        if (!compact)
-        {
-            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
-            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
-
-            idx = 2;
-        }
-
-        controls.push_back(Button(idx, "icons/map.png", idx, idx + 1, compact ? idx : 1, idx, startx, buttony, Control::Type::MAP));
-        controls.push_back(Button(idx + 1, "icons/disk.png", idx, idx + 2, compact ? idx + 1 : 1, idx + 1, startx + gridsize, buttony, Control::Type::GAME));
-        controls.push_back(Button(idx + 2, "icons/user.png", idx + 1, idx + 3, compact ? idx + 2 : 1, idx + 2, startx + 2 * gridsize, buttony, Control::Type::CHARACTER));
-        controls.push_back(Button(idx + 3, "icons/items.png", idx + 2, idx + 4, compact ? idx + 3 : 1, idx + 3, startx + 3 * gridsize, buttony, Control::Type::USE));
-        controls.push_back(Button(idx + 4, "icons/next.png", idx + 3, idx + 5, compact ? idx + 4 : 1, idx + 4, startx + 4 * gridsize, buttony, Control::Type::NEXT));
-        controls.push_back(Button(idx + 5, "icons/shop.png", idx + 4, idx + 6, compact ? idx + 5 : 1, idx + 5, startx + 5 * gridsize, buttony, Control::Type::TRADE));
-        controls.push_back(Button(idx + 6, "icons/exit.png", idx + 5, idx + 6, compact ? idx + 6 : 1, idx + 6, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        return controls;
-    }
-
-    std::vector<Button> ExitControls(bool compact = false)
-    {
-        auto idx = 0;
-
-        auto controls = std::vector<Button>();
-
-        if (!compact)
-        {
-            controls.push_back(Button(0, "icons/up-arrow.png", 0, 1, 0, 1, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + border_space, Control::Type::SCROLL_UP));
-            controls.push_back(Button(1, "icons/down-arrow.png", 0, 2, 0, 2, (1.0 - Margin) * SCREEN_WIDTH - arrow_size, texty + text_bounds - arrow_size - border_space, Control::Type::SCROLL_DOWN));
-
-            idx = 2;
-        }
-
-        controls.push_back(Button(idx, "icons/exit.png", compact ? idx : idx - 1, idx, compact ? idx : idx - 1, idx, (1.0 - Margin) * SCREEN_WIDTH - buttonw, buttony, Control::Type::BACK));
-
-        return controls;
-    }
-
 } // namespace Story
 
 class NotImplemented : public Story::Base
@@ -395,15 +113,25 @@ public:
     }
 };
 
-auto notImplemented = NotImplemented();
+// sections keep per-visit state, so every thread that runs the game gets its own copies
+thread_local auto notImplemented = NotImplemented();
+
+thread_local auto Stories = std::vector<Story::Base *>();
 
-auto Stories = std::vector<Story::Base *>();
+// Stories in StoryGraph::IDS order, so that finding a section is a binary search rather than a scan
+thread_local auto Sections = std::vector<Story::Base *>();
 
 void *findStory(int id)
 {
     Story::Base *story = &notImplemented;
 
-    if (Stories.size() > 0)
+    auto index = StoryGraph::INDEX(id);
+
+    if (index >= 0 && index < Sections.size() && Sections[index] != NULL)
+    {
+        story = Sections[index];
+    }
+    else if (Stories.size() > 0)
     {
         for (auto i = 0; i < Stories.size(); i++)
         {
@@ -1915,7 +1643,7 @@ public:
         }
         else if (Character::HAS_SKILL(player, Skill::Type::BRAWLING))
         {
-            player.SKILLS_LIMIT = 3;
+            Character::SET_SKILLS_LIMIT(player, 3);
 
             Character::LOSE_SKILLS(player, {Skill::Type::BRAWLING});
 
@@ -1923,7 +1651,7 @@ public:
         }
         else if (Character::HAS_SKILL(player, Skill::Type::ROGUERY))
         {
-            player.SKILLS_LIMIT = 3;
+            Character::SET_SKILLS_LIMIT(player, 3);
 
             Character::LOSE_SKILLS(player, {Skill::Type::ROGUERY});
 
@@ -1948,9 +1676,9 @@ public:
 
     int Background(Character::Base &player)
     {
-        player.SKILLS_LIMIT = 4;
-        player.Skills.push_back(Skill::ROGUERY);
-        player.Skills.push_back(Skill::BRAWLING);
+        Character::SET_SKILLS_LIMIT(player, 4);
+
+        Character::GET_SKILLS(player, {Skill::ROGUERY, Skill::BRAWLING});
 
         return 9;
     }
@@ -2135,7 +1863,7 @@ public:
 
         auto count = 0;
 
-        std::vector<Item::Base> bribe = {Item::SWORD, Item::PISTOL, Item::MAGIC_WAND, Item::MAGIC_AMULET, Item::SHIP_IN_BOTTLE, Item::CONCH_SHELL_HORN, Item::BAT_SHAPED_TALISMAN, Item::BLACK_KITE, Item::DIAMOND, Item::TOOLKIT, Item::HEALING_POTION, Item::BRONZE_HELMET, Item::CRUCIFIX, Item::DRAGON_RING};
+        Item::List bribe = {Item::SWORD, Item::PISTOL, Item::MAGIC_WAND, Item::MAGIC_AMULET, Item::SHIP_IN_BOTTLE, Item::CONCH_SHELL_HORN, Item::BAT_SHAPED_TALISMAN, Item::BLACK_KITE, Item::DIAMOND, Item::TOOLKIT, Item::HEALING_POTION, Item::BRONZE_HELMET, Item::CRUCIFIX, Item::DRAGON_RING};
 
         for (auto i = 0; i < bribe.size(); i++)
         {
@@ -2287,7 +2015,7 @@ public:
 
         Text = PreText.c_str();
 
-        player.TemporarySkills.clear();
+        Character::CLEAR_TEMPORARY_SKILLS(player);
     }
 
     int Continue(Character::Base &player) { return 225; }
@@ -2806,7 +2534,7 @@ public:
             if (player.Items[i].Type == Item::Type::PISTOL)
             {
                 // Disable first pistol
-                player.Items[i].Charge = 0;
+                Character::SET_CHARGE(player, i, 0);
 
                 break;
             }
@@ -2929,7 +2657,7 @@ public:
         {
             PreText += "Your combination of skills are insufficient to save you. You are quickly slain.";
 
-            player.Life = 0;
+            Character::SET_LIFE(player, 0);
         }
 
         Text = PreText.c_str();
@@ -3363,7 +3091,7 @@ public:
 
         auto count = 0;
 
-        std::vector<Item::Base> bribe = {Item::SWORD, Item::PISTOL, Item::MAGIC_WAND, Item::MAGIC_AMULET, Item::CRUCIFIX, Item::TOOLKIT};
+        Item::List bribe = {Item::SWORD, Item::PISTOL, Item::MAGIC_WAND, Item::MAGIC_AMULET, Item::CRUCIFIX, Item::TOOLKIT};
 
         for (auto i = 0; i < bribe.size(); i++)
         {
@@ -3459,7 +3187,7 @@ public:
     {
         PreText = "You suggest that, instead of draining one person's entire soul so that he dies, she contents herself with a quarter of the life force taken from each of you. She considers this, then gives a short regal nod. \"I accept. Step forward , mortals.\"\n\nShe lays her knife against the chest of each of you in turn. A cold chill spreads through you as her magic leeches a part of your very soul.\n\nYou PERMANENTLY LOSE 1 Life Point and a skill of your choice.";
 
-        player.MAX_LIFE_LIMIT--;
+        Character::SET_LIFE_LIMIT(player, player.MAX_LIFE_LIMIT - 1);
 
         Character::GAIN_LIFE(player, -1);
 
@@ -3469,7 +3197,7 @@ public:
         {
             if (player.Skills.size() < player.SKILLS_LIMIT)
             {
-                player.SKILLS_LIMIT = player.Skills.size();
+                Character::SET_SKILLS_LIMIT(player, player.Skills.size());
             }
 
             Choices.push_back(Choice::Base("Choose which skill to lose", 137, Choice::Type::LOSE_SKILLS, player.SKILLS_LIMIT - 1));
@@ -3478,7 +3206,7 @@ public:
         {
             PreText += "\n\nYour entire soul has been drained.";
 
-            player.Life = 0;
+            Character::SET_LIFE(player, 0);
         }
 
         Text = PreText.c_str();
@@ -4001,7 +3729,7 @@ public:
         {
             PreText += "\n\nThere is nothing you can do to save yourself. Your adventure ends right here.";
 
-            player.Life = 0;
+            Character::SET_LIFE(player, 0);
         }
 
         Text = PreText.c_str();
@@ -4523,9 +4251,7 @@ public:
     {
         Character::LOSE_ITEMS(player, {Item::Type::SWORD, Item::Type::PISTOL});
 
-        player.LostMoney += player.Money;
-
-        player.Money = 0;
+        Character::LOSE_MONEY(player);
     }
 
     int Continue(Character::Base &player) { return 374; }
@@ -4585,7 +4311,7 @@ public:
 
         if (!Character::HAS_SKILL(player, Skill::Type::SEAFARING))
         {
-            player.Skills.push_back(Skill::SEAFARING);
+            Character::GET_SKILLS(player, {Skill::SEAFARING});
         }
 
         if (!Character::VERIFY_ITEMS(player, {Item::Type::CORKSCREW, Item::Type::SHIP_IN_BOTTLE}) && !Character::VERIFY_ITEMS(player, {Item::Type::DEED_OF_OWNERSHIP}) && !Character::VERIFY_ITEMS(player, {Item::Type::DIAMOND}))
@@ -4705,7 +4431,7 @@ public:
 
         Text = PreText.c_str();
 
-        player.TemporarySkills.clear();
+        Character::CLEAR_TEMPORARY_SKILLS(player);
     }
 
     int Continue(Character::Base &player) { return 361; }
@@ -5011,7 +4737,7 @@ public:
         {
             PreText += "\n\nYou sell your lives dearly, but in an ultimately futile massacre.";
 
-            player.Life = 0;
+            Character::SET_LIFE(player, 0);
         }
 
         Text = PreText.c_str();
@@ -5051,43 +4777,7 @@ public:
 
     int Background(Character::Base &player)
     {
-        if (player.Ship.Type != Ship::Type::NONE)
-        {
-            switch (player.Ship.Type)
-            {
-            case Ship::Type::LADY_OF_SHALOTT:
-                player.Ship.Stars = 1;
-                break;
-            case Ship::Type::SHIVERED_TIMBER:
-                player.Ship.Stars = 2;
-                break;
-            case Ship::Type::QUEENS_RANSOM:
-                player.Ship.Stars = 3;
-                break;
-            case Ship::Type::FAERIE_QUEEN:
-                player.Ship.Stars = 3;
-                break;
-            case Ship::Type::METEOR:
-                player.Ship.Stars = 4;
-                break;
-            case Ship::Type::OCTAVIUS:
-                player.Ship.Stars = 4;
-                break;
-            case Ship::Type::PROVIDENCE:
-                player.Ship.Stars = 5;
-                break;
-            case Ship::Type::CALYPSO:
-                player.Ship.Stars = 5;
-                break;
-            default:
-                player.Ship.Stars = 1;
-                break;
-            }
-        }
-        else
-        {
-            player.Ship.Stars = 0;
-        }
+        Character::REPAIR_SHIP(player);
 
         return 320;
     }
@@ -5195,16 +4885,16 @@ public:
 
     void Event(Character::Base &player)
     {
-        player.TemporarySkills.clear();
+        Character::CLEAR_TEMPORARY_SKILLS(player);
 
         if (!Character::HAS_SKILL(player, Skill::Type::BRAWLING))
         {
-            player.TemporarySkills.push_back(Skill::BRAWLING);
+            Character::GET_TEMPORARY_SKILLS(player, {Skill::BRAWLING});
         }
 
         if (!Character::HAS_SKILL(player, Skill::Type::SWORDPLAY))
         {
-            player.TemporarySkills.push_back(Skill::SWORDPLAY);
+            Character::GET_TEMPORARY_SKILLS(player, {Skill::SWORDPLAY});
         }
     }
 
@@ -5417,7 +5107,7 @@ public:
 
     void Event(Character::Base &player)
     {
-        player.Items.clear();
+        Character::CLEAR_ITEMS(player);
 
         Character::GET_ITEMS(player, {Item::MAGIC_AMULET});
     }
@@ -7333,16 +7023,16 @@ public:
 
     void Event(Character::Base &player)
     {
-        player.TemporarySkills.clear();
+        Character::CLEAR_TEMPORARY_SKILLS(player);
 
         if (!Character::HAS_SKILL(player, Skill::Type::BRAWLING))
         {
-            player.TemporarySkills.push_back(Skill::BRAWLING);
+            Character::GET_TEMPORARY_SKILLS(player, {Skill::BRAWLING});
         }
 
         if (!Character::HAS_SKILL(player, Skill::Type::SWORDPLAY))
         {
-            player.TemporarySkills.push_back(Skill::SWORDPLAY);
+            Character::GET_TEMPORARY_SKILLS(player, {Skill::SWORDPLAY});
         }
     }
 
@@ -7470,7 +7160,7 @@ public:
 
             PreText += "You supplement your diet with game and make a full recovery.";
 
-            player.Life = player.MAX_LIFE_LIMIT;
+            Character::SET_LIFE(player, player.MAX_LIFE_LIMIT);
         }
         else
         {
@@ -7561,7 +7251,7 @@ public:
 
         auto count = 0;
 
-        std::vector<Item::Base> bribe = {Item::SWORD, Item::PISTOL, Item::MAGIC_WAND, Item::MAGIC_AMULET, Item::SHIP_IN_BOTTLE, Item::CONCH_SHELL_HORN, Item::BAT_SHAPED_TALISMAN, Item::BLACK_KITE};
+        Item::List bribe = {Item::SWORD, Item::PISTOL, Item::MAGIC_WAND, Item::MAGIC_AMULET, Item::SHIP_IN_BOTTLE, Item::CONCH_SHELL_HORN, Item::BAT_SHAPED_TALISMAN, Item::BLACK_KITE};
 
         for (auto i = 0; i < bribe.size(); i++)
         {
@@ -8005,7 +7695,7 @@ public:
 
         auto count = 0;
 
-        std::vector<Item::Base> bribe = {Item::SWORD, Item::PISTOL, Item::MAGIC_WAND, Item::MAGIC_AMULET, Item::CONCH_SHELL_HORN, Item::BAT_SHAPED_TALISMAN, Item::BLACK_KITE};
+        Item::List bribe = {Item::SWORD, Item::PISTOL, Item::MAGIC_WAND, Item::MAGIC_AMULET, Item::CONCH_SHELL_HORN, Item::BAT_SHAPED_TALISMAN, Item::BLACK_KITE};
 
         for (auto i = 0; i < bribe.size(); i++)
         {
@@ -8427,7 +8117,7 @@ public:
 
         Text = PreText.c_str();
 
-        player.TemporarySkills.clear();
+        Character::CLEAR_TEMPORARY_SKILLS(player);
     }
 
     int Continue(Character::Base &player) { return 342; }
@@ -8628,7 +8318,7 @@ public:
 
         Text = PreText.c_str();
 
-        player.TemporarySkills.clear();
+        Character::CLEAR_TEMPORARY_SKILLS(player);
     }
 
     int Continue(Character::Base &player) { return 136; }
@@ -9020,7 +8710,7 @@ public:
 
     void Event(Character::Base &player)
     {
-        player.Life = player.MAX_LIFE_LIMIT;
+        Character::SET_LIFE(player, player.MAX_LIFE_LIMIT);
     }
 };
 
@@ -9859,7 +9549,7 @@ public:
 
         auto count = 0;
 
-        std::vector<Item::Base> bribe = {Item::SWORD, Item::PISTOL, Item::MAGIC_WAND, Item::MAGIC_AMULET, Item::CRUCIFIX, Item::TOOLKIT};
+        Item::List bribe = {Item::SWORD, Item::PISTOL, Item::MAGIC_WAND, Item::MAGIC_AMULET, Item::CRUCIFIX, Item::TOOLKIT};
 
         for (auto i = 0; i < bribe.size(); i++)
         {
@@ -10378,10 +10068,14 @@ public:
             PreText += "[Item: FEATHER SHIELD] ";
         }
 
+        Character::GAIN_LIFE(player, DAMAGE);
+
         PreText += "You LOSE " + std::to_string(-DAMAGE) + " Life Points.";
 
         Text = PreText.c_str();
     }
+
+    int Continue(Character::Base &player) { return 328; }
 };
 
 class Story403 : public Story::Base
@@ -11013,442 +10707,442 @@ public:
     }
 };
 
-auto prologue = Prologue();
-auto story001 = Story001();
-auto story002 = Story002();
-auto story003 = Story003();
-auto story004 = Story004();
-auto story005 = Story005();
-auto story006 = Story006();
-auto story007 = Story007();
-auto story008 = Story008();
-auto story009 = Story009();
-auto story010 = Story010();
-auto story011 = Story011();
-auto story012 = Story012();
-auto story013 = Story013();
-auto story014 = Story014();
-auto story015 = Story015();
-auto story016 = Story016();
-auto story017 = Story017();
-auto story018 = Story018();
-auto story019 = Story019();
-auto story020 = Story020();
-auto story021 = Story021();
-auto story022 = Story022();
-auto story023 = Story023();
-auto story024 = Story024();
-auto story025 = Story025();
-auto story026 = Story026();
-auto story027 = Story027();
-auto story028 = Story028();
-auto story029 = Story029();
-auto story030 = Story030();
-auto story031 = Story031();
-auto story032 = Story032();
-auto story033 = Story033();
-auto story034 = Story034();
-auto story035 = Story035();
-auto story036 = Story036();
-auto story037 = Story037();
-auto story038 = Story038();
-auto story039 = Story039();
-auto story040 = Story040();
-auto story041 = Story041();
-auto story042 = Story042();
-auto story043 = Story043();
-auto story044 = Story044();
-auto story045 = Story045();
-auto story046 = Story046();
-auto story047 = Story047();
-auto story048 = Story048();
-auto story049 = Story049();
-auto story050 = Story050();
-auto story051 = Story051();
-auto story052 = Story052();
-auto story053 = Story053();
-auto story054 = Story054();
-auto story055 = Story055();
-auto story056 = Story056();
-auto story057 = Story057();
-auto story058 = Story058();
-auto story059 = Story059();
-auto event059 = Event059();
-auto story060 = Story060();
-auto story061 = Story061();
-auto story062 = Story062();
-auto story063 = Story063();
-auto story064 = Story064();
-auto story065 = Story065();
-auto story066 = Story066();
-auto story067 = Story067();
-auto story068 = Story068();
-auto story069 = Story069();
-auto story070 = Story070();
-auto story071 = Story071();
-auto story072 = Story072();
-auto story073 = Story073();
-auto story074 = Story074();
-auto story075 = Story075();
-auto story076 = Story076();
-auto story077 = Story077();
-auto story078 = Story078();
-auto story079 = Story079();
-auto story080 = Story080();
-auto story081 = Story081();
-auto story082 = Story082();
-auto story083 = Story083();
-auto story084 = Story084();
-auto story085 = Story085();
-auto story086 = Story086();
-auto story087 = Story087();
-auto story088 = Story088();
-auto story089 = Story089();
-auto story090 = Story090();
-auto story091 = Story091();
-auto story092 = Story092();
-auto story093 = Story093();
-auto story094 = Story094();
-auto story095 = Story095();
-auto story096 = Story096();
-auto story097 = Story097();
-auto story098 = Story098();
-auto story099 = Story099();
-auto story100 = Story100();
-auto story101 = Story101();
-auto story102 = Story102();
-auto story103 = Story103();
-auto story104 = Story104();
-auto story105 = Story105();
-auto story106 = Story106();
-auto story107 = Story107();
-auto story108 = Story108();
-auto story109 = Story109();
-auto story110 = Story110();
-auto story111 = Story111();
-auto story112 = Story112();
-auto story113 = Story113();
-auto story114 = Story114();
-auto story115 = Story115();
-auto story116 = Story116();
-auto story117 = Story117();
-auto event117 = Event117();
-auto story118 = Story118();
-auto story119 = Story119();
-auto story120 = Story120();
-auto story121 = Story121();
-auto story122 = Story122();
-auto story123 = Story123();
-auto story124 = Story124();
-auto story125 = Story125();
-auto story126 = Story126();
-auto story127 = Story127();
-auto story128 = Story128();
-auto story129 = Story129();
-auto story130 = Story130();
-auto story131 = Story131();
-auto story132 = Story132();
-auto story133 = Story133();
-auto story134 = Story134();
-auto story135 = Story135();
-auto story136 = Story136();
-auto story137 = Story137();
-auto story138 = Story138();
-auto story139 = Story139();
-auto story140 = Story140();
-auto story141 = Story141();
-auto story142 = Story142();
-auto story143 = Story143();
-auto story144 = Story144();
-auto story145 = Story145();
-auto story146 = Story146();
-auto story147 = Story147();
-auto story148 = Story148();
-auto story149 = Story149();
-auto story150 = Story150();
-auto story151 = Story151();
-auto story152 = Story152();
-auto story153 = Story153();
-auto story154 = Story154();
-auto story155 = Story155();
-auto story156 = Story156();
-auto story157 = Story157();
-auto story158 = Story158();
-auto story159 = Story159();
-auto story160 = Story160();
-auto story161 = Story161();
-auto story162 = Story162();
-auto story163 = Story163();
-auto story164 = Story164();
-auto story165 = Story165();
-auto story166 = Story166();
-auto story167 = Story167();
-auto event167 = Event167();
-auto story168 = Story168();
-auto story169 = Story169();
-auto story170 = Story170();
-auto story171 = Story171();
-auto story172 = Story172();
-auto story173 = Story173();
-auto story174 = Story174();
-auto story175 = Story175();
-auto story176 = Story176();
-auto story177 = Story177();
-auto story178 = Story178();
-auto story179 = Story179();
-auto story180 = Story180();
-auto story181 = Story181();
-auto story182 = Story182();
-auto story183 = Story183();
-auto story184 = Story184();
-auto story185 = Story185();
-auto story186 = Story186();
-auto story187 = Story187();
-auto story188 = Story188();
-auto story189 = Story189();
-auto story190 = Story190();
-auto story191 = Story191();
-auto story192 = Story192();
-auto story193 = Story193();
-auto story194 = Story194();
-auto story195 = Story195();
-auto story196 = Story196();
-auto story197 = Story197();
-auto story198 = Story198();
-auto story199 = Story199();
-auto story200 = Story200();
-auto story201 = Story201();
-auto story202 = Story202();
-auto story203 = Story203();
-auto story204 = Story204();
-auto story205 = Story205();
-auto story206 = Story206();
-auto story207 = Story207();
-auto story208 = Story208();
-auto story209 = Story209();
-auto story210 = Story210();
-auto story211 = Story211();
-auto story212 = Story212();
-auto story213 = Story213();
-auto story214 = Story214();
-auto story215 = Story215();
-auto story216 = Story216();
-auto story217 = Story217();
-auto story218 = Story218();
-auto story219 = Story219();
-auto story220 = Story220();
-auto story221 = Story221();
-auto story222 = Story222();
-auto story223 = Story223();
-auto story224 = Story224();
-auto story225 = Story225();
-auto event225 = Event225();
-auto story226 = Story226();
-auto story227 = Story227();
-auto story228 = Story228();
-auto story229 = Story229();
-auto story230 = Story230();
-auto story231 = Story231();
-auto story232 = Story232();
-auto story233 = Story233();
-auto story234 = Story234();
-auto story235 = Story235();
-auto story236 = Story236();
-auto story237 = Story237();
-auto story238 = Story238();
-auto story239 = Story239();
-auto story240 = Story240();
-auto story241 = Story241();
-auto story242 = Story242();
-auto story243 = Story243();
-auto story244 = Story244();
-auto story245 = Story245();
-auto story246 = Story246();
-auto story247 = Story247();
-auto story248 = Story248();
-auto story249 = Story249();
-auto story250 = Story250();
-auto story251 = Story251();
-auto story252 = Story252();
-auto story253 = Story253();
-auto story254 = Story254();
-auto story255 = Story255();
-auto story256 = Story256();
-auto story257 = Story257();
-auto story258 = Story258();
-auto story259 = Story259();
-auto story260 = Story260();
-auto story261 = Story261();
-auto story262 = Story262();
-auto story263 = Story263();
-auto story264 = Story264();
-auto story265 = Story265();
-auto story266 = Story266();
-auto story267 = Story267();
-auto story268 = Story268();
-auto story269 = Story269();
-auto story270 = Story270();
-auto story271 = Story271();
-auto story272 = Story272();
-auto story273 = Story273();
-auto story274 = Story274();
-auto story275 = Story275();
-auto story276 = Story276();
-auto story277 = Story277();
-auto story278 = Story278();
-auto story279 = Story279();
-auto story280 = Story280();
-auto story281 = Story281();
-auto story282 = Story282();
-auto story283 = Story283();
-auto story284 = Story284();
-auto story285 = Story285();
-auto story286 = Story286();
-auto story287 = Story287();
-auto story288 = Story288();
-auto story289 = Story289();
-auto story290 = Story290();
-auto story291 = Story291();
-auto story292 = Story292();
-auto story293 = Story293();
-auto story294 = Story294();
-auto story295 = Story295();
-auto story296 = Story296();
-auto story297 = Story297();
-auto story298 = Story298();
-auto story299 = Story299();
-auto story300 = Story300();
-auto story301 = Story301();
-auto story302 = Story302();
-auto story303 = Story303();
-auto story304 = Story304();
-auto story305 = Story305();
-auto story306 = Story306();
-auto story307 = Story307();
-auto story308 = Story308();
-auto story309 = Story309();
-auto story310 = Story310();
-auto event310 = Event310();
-auto story311 = Story311();
-auto story312 = Story312();
-auto story313 = Story313();
-auto story314 = Story314();
-auto story315 = Story315();
-auto story316 = Story316();
-auto event316 = Event316();
-auto story317 = Story317();
-auto story318 = Story318();
-auto story319 = Story319();
-auto story320 = Story320();
-auto story321 = Story321();
-auto story322 = Story322();
-auto story323 = Story323();
-auto story324 = Story324();
-auto story325 = Story325();
-auto story326 = Story326();
-auto story327 = Story327();
-auto story328 = Story328();
-auto story329 = Story329();
-auto story330 = Story330();
-auto story331 = Story331();
-auto story332 = Story332();
-auto story333 = Story333();
-auto story334 = Story334();
-auto event335 = Event335();
-auto story335 = Story335();
-auto story336 = Story336();
-auto story337 = Story337();
-auto story338 = Story338();
-auto story339 = Story339();
-auto story340 = Story340();
-auto story341 = Story341();
-auto story342 = Story342();
-auto story343 = Story343();
-auto story344 = Story344();
-auto story345 = Story345();
-auto story346 = Story346();
-auto story347 = Story347();
-auto story348 = Story348();
-auto story349 = Story349();
-auto story350 = Story350();
-auto story351 = Story351();
-auto story352 = Story352();
-auto story353 = Story353();
-auto story354 = Story354();
-auto event354 = Event354();
-auto story355 = Story355();
-auto story356 = Story356();
-auto story357 = Story357();
-auto story358 = Story358();
-auto story359 = Story359();
-auto story360 = Story360();
-auto story361 = Story361();
-auto story362 = Story362();
-auto story363 = Story363();
-auto story364 = Story364();
-auto story365 = Story365();
-auto story366 = Story366();
-auto story367 = Story367();
-auto story368 = Story368();
-auto story369 = Story369();
-auto story370 = Story370();
-auto story371 = Story371();
-auto story372 = Story372();
-auto story373 = Story373();
-auto story374 = Story374();
-auto story375 = Story375();
-auto story376 = Story376();
-auto story377 = Story377();
-auto story378 = Story378();
-auto story379 = Story379();
-auto story380 = Story380();
-auto story381 = Story381();
-auto story382 = Story382();
-auto story383 = Story383();
-auto story384 = Story384();
-auto story385 = Story385();
-auto story386 = Story386();
-auto story387 = Story387();
-auto story388 = Story388();
-auto story389 = Story389();
-auto story390 = Story390();
-auto story391 = Story391();
-auto story392 = Story392();
-auto story393 = Story393();
-auto story394 = Story394();
-auto story395 = Story395();
-auto story396 = Story396();
-auto story397 = Story397();
-auto story398 = Story398();
-auto story399 = Story399();
-auto story400 = Story400();
-auto story401 = Story401();
-auto story402 = Story402();
-auto story403 = Story403();
-auto story404 = Story404();
-auto story405 = Story405();
-auto story406 = Story406();
-auto story407 = Story407();
-auto story408 = Story408();
-auto story409 = Story409();
-auto story410 = Story410();
-auto story411 = Story411();
-auto story412 = Story412();
-auto story413 = Story413();
-auto story414 = Story414();
-auto story415 = Story415();
-auto story416 = Story416();
-auto story417 = Story417();
-auto story418 = Story418();
-auto story419 = Story419();
-auto story420 = Story420();
-auto story421 = Story421();
-auto story422 = Story422();
-auto story423 = Story423();
-auto story424 = Story424();
-auto story425 = Story425();
-auto story426 = Story426();
-auto story427 = Story427();
+thread_local auto prologue = Prologue();
+thread_local auto story001 = Story001();
+thread_local auto story002 = Story002();
+thread_local auto story003 = Story003();
+thread_local auto story004 = Story004();
+thread_local auto story005 = Story005();
+thread_local auto story006 = Story006();
+thread_local auto story007 = Story007();
+thread_local auto story008 = Story008();
+thread_local auto story009 = Story009();
+thread_local auto story010 = Story010();
+thread_local auto story011 = Story011();
+thread_local auto story012 = Story012();
+thread_local auto story013 = Story013();
+thread_local auto story014 = Story014();
+thread_local auto story015 = Story015();
+thread_local auto story016 = Story016();
+thread_local auto story017 = Story017();
+thread_local auto story018 = Story018();
+thread_local auto story019 = Story019();
+thread_local auto story020 = Story020();
+thread_local auto story021 = Story021();
+thread_local auto story022 = Story022();
+thread_local auto story023 = Story023();
+thread_local auto story024 = Story024();
+thread_local auto story025 = Story025();
+thread_local auto story026 = Story026();
+thread_local auto story027 = Story027();
+thread_local auto story028 = Story028();
+thread_local auto story029 = Story029();
+thread_local auto story030 = Story030();
+thread_local auto story031 = Story031();
+thread_local auto story032 = Story032();
+thread_local auto story033 = Story033();
+thread_local auto story034 = Story034();
+thread_local auto story035 = Story035();
+thread_local auto story036 = Story036();
+thread_local auto story037 = Story037();
+thread_local auto story038 = Story038();
+thread_local auto story039 = Story039();
+thread_local auto story040 = Story040();
+thread_local auto story041 = Story041();
+thread_local auto story042 = Story042();
+thread_local auto story043 = Story043();
+thread_local auto story044 = Story044();
+thread_local auto story045 = Story045();
+thread_local auto story046 = Story046();
+thread_local auto story047 = Story047();
+thread_local auto story048 = Story048();
+thread_local auto story049 = Story049();
+thread_local auto story050 = Story050();
+thread_local auto story051 = Story051();
+thread_local auto story052 = Story052();
+thread_local auto story053 = Story053();
+thread_local auto story054 = Story054();
+thread_local auto story055 = Story055();
+thread_local auto story056 = Story056();
+thread_local auto story057 = Story057();
+thread_local auto story058 = Story058();
+thread_local auto story059 = Story059();
+thread_local auto event059 = Event059();
+thread_local auto story060 = Story060();
+thread_local auto story061 = Story061();
+thread_local auto story062 = Story062();
+thread_local auto story063 = Story063();
+thread_local auto story064 = Story064();
+thread_local auto story065 = Story065();
+thread_local auto story066 = Story066();
+thread_local auto story067 = Story067();
+thread_local auto story068 = Story068();
+thread_local auto story069 = Story069();
+thread_local auto story070 = Story070();
+thread_local auto story071 = Story071();
+thread_local auto story072 = Story072();
+thread_local auto story073 = Story073();
+thread_local auto story074 = Story074();
+thread_local auto story075 = Story075();
+thread_local auto story076 = Story076();
+thread_local auto story077 = Story077();
+thread_local auto story078 = Story078();
+thread_local auto story079 = Story079();
+thread_local auto story080 = Story080();
+thread_local auto story081 = Story081();
+thread_local auto story082 = Story082();
+thread_local auto story083 = Story083();
+thread_local auto story084 = Story084();
+thread_local auto story085 = Story085();
+thread_local auto story086 = Story086();
+thread_local auto story087 = Story087();
+thread_local auto story088 = Story088();
+thread_local auto story089 = Story089();
+thread_local auto story090 = Story090();
+thread_local auto story091 = Story091();
+thread_local auto story092 = Story092();
+thread_local auto story093 = Story093();
+thread_local auto story094 = Story094();
+thread_local auto story095 = Story095();
+thread_local auto story096 = Story096();
+thread_local auto story097 = Story097();
+thread_local auto story098 = Story098();
+thread_local auto story099 = Story099();
+thread_local auto story100 = Story100();
+thread_local auto story101 = Story101();
+thread_local auto story102 = Story102();
+thread_local auto story103 = Story103();
+thread_local auto story104 = Story104();
+thread_local auto story105 = Story105();
+thread_local auto story106 = Story106();
+thread_local auto story107 = Story107();
+thread_local auto story108 = Story108();
+thread_local auto story109 = Story109();
+thread_local auto story110 = Story110();
+thread_local auto story111 = Story111();
+thread_local auto story112 = Story112();
+thread_local auto story113 = Story113();
+thread_local auto story114 = Story114();
+thread_local auto story115 = Story115();
+thread_local auto story116 = Story116();
+thread_local auto story117 = Story117();
+thread_local auto event117 = Event117();
+thread_local auto story118 = Story118();
+thread_local auto story119 = Story119();
+thread_local auto story120 = Story120();
+thread_local auto story121 = Story121();
+thread_local auto story122 = Story122();
+thread_local auto story123 = Story123();
+thread_local auto story124 = Story124();
+thread_local auto story125 = Story125();
+thread_local auto story126 = Story126();
+thread_local auto story127 = Story127();
+thread_local auto story128 = Story128();
+thread_local auto story129 = Story129();
+thread_local auto story130 = Story130();
+thread_local auto story131 = Story131();
+thread_local auto story132 = Story132();
+thread_local auto story133 = Story133();
+thread_local auto story134 = Story134();
+thread_local auto story135 = Story135();
+thread_local auto story136 = Story136();
+thread_local auto story137 = Story137();
+thread_local auto story138 = Story138();
+thread_local auto story139 = Story139();
+thread_local auto story140 = Story140();
+thread_local auto story141 = Story141();
+thread_local auto story142 = Story142();
+thread_local auto story143 = Story143();
+thread_local auto story144 = Story144();
+thread_local auto story145 = Story145();
+thread_local auto story146 = Story146();
+thread_local auto story147 = Story147();
+thread_local auto story148 = Story148();
+thread_local auto story149 = Story149();
+thread_local auto story150 = Story150();
+thread_local auto story151 = Story151();
+thread_local auto story152 = Story152();
+thread_local auto story153 = Story153();
+thread_local auto story154 = Story154();
+thread_local auto story155 = Story155();
+thread_local auto story156 = Story156();
+thread_local auto story157 = Story157();
+thread_local auto story158 = Story158();
+thread_local auto story159 = Story159();
+thread_local auto story160 = Story160();
+thread_local auto story161 = Story161();
+thread_local auto story162 = Story162();
+thread_local auto story163 = Story163();
+thread_local auto story164 = Story164();
+thread_local auto story165 = Story165();
+thread_local auto story166 = Story166();
+thread_local auto story167 = Story167();
+thread_local auto event167 = Event167();
+thread_local auto story168 = Story168();
+thread_local auto story169 = Story169();
+thread_local auto story170 = Story170();
+thread_local auto story171 = Story171();
+thread_local auto story172 = Story172();
+thread_local auto story173 = Story173();
+thread_local auto story174 = Story174();
+thread_local auto story175 = Story175();
+thread_local auto story176 = Story176();
+thread_local auto story177 = Story177();
+thread_local auto story178 = Story178();
+thread_local auto story179 = Story179();
+thread_local auto story180 = Story180();
+thread_local auto story181 = Story181();
+thread_local auto story182 = Story182();
+thread_local auto story183 = Story183();
+thread_local auto story184 = Story184();
+thread_local auto story185 = Story185();
+thread_local auto story186 = Story186();
+thread_local auto story187 = Story187();
+thread_local auto story188 = Story188();
+thread_local auto story189 = Story189();
+thread_local auto story190 = Story190();
+thread_local auto story191 = Story191();
+thread_local auto story192 = Story192();
+thread_local auto story193 = Story193();
+thread_local auto story194 = Story194();
+thread_local auto story195 = Story195();
+thread_local auto story196 = Story196();
+thread_local auto story197 = Story197();
+thread_local auto story198 = Story198();
+thread_local auto story199 = Story199();
+thread_local auto story200 = Story200();
+thread_local auto story201 = Story201();
+thread_local auto story202 = Story202();
+thread_local auto story203 = Story203();
+thread_local auto story204 = Story204();
+thread_local auto story205 = Story205();
+thread_local auto story206 = Story206();
+thread_local auto story207 = Story207();
+thread_local auto story208 = Story208();
+thread_local auto story209 = Story209();
+thread_local auto story210 = Story210();
+thread_local auto story211 = Story211();
+thread_local auto story212 = Story212();
+thread_local auto story213 = Story213();
+thread_local auto story214 = Story214();
+thread_local auto story215 = Story215();
+thread_local auto story216 = Story216();
+thread_local auto story217 = Story217();
+thread_local auto story218 = Story218();
+thread_local auto story219 = Story219();
+thread_local auto story220 = Story220();
+thread_local auto story221 = Story221();
+thread_local auto story222 = Story222();
+thread_local auto story223 = Story223();
+thread_local auto story224 = Story224();
+thread_local auto story225 = Story225();
+thread_local auto event225 = Event225();
+thread_local auto story226 = Story226();
+thread_local auto story227 = Story227();
+thread_local auto story228 = Story228();
+thread_local auto story229 = Story229();
+thread_local auto story230 = Story230();
+thread_local auto story231 = Story231();
+thread_local auto story232 = Story232();
+thread_local auto story233 = Story233();
+thread_local auto story234 = Story234();
+thread_local auto story235 = Story235();
+thread_local auto story236 = Story236();
+thread_local auto story237 = Story237();
+thread_local auto story238 = Story238();
+thread_local auto story239 = Story239();
+thread_local auto story240 = Story240();
+thread_local auto story241 = Story241();
+thread_local auto story242 = Story242();
+thread_local auto story243 = Story243();
+thread_local auto story244 = Story244();
+thread_local auto story245 = Story245();
+thread_local auto story246 = Story246();
+thread_local auto story247 = Story247();
+thread_local auto story248 = Story248();
+thread_local auto story249 = Story249();
+thread_local auto story250 = Story250();
+thread_local auto story251 = Story251();
+thread_local auto story252 = Story252();
+thread_local auto story253 = Story253();
+thread_local auto story254 = Story254();
+thread_local auto story255 = Story255();
+thread_local auto story256 = Story256();
+thread_local auto story257 = Story257();
+thread_local auto story258 = Story258();
+thread_local auto story259 = Story259();
+thread_local auto story260 = Story260();
+thread_local auto story261 = Story261();
+thread_local auto story262 = Story262();
+thread_local auto story263 = Story263();
+thread_local auto story264 = Story264();
+thread_local auto story265 = Story265();
+thread_local auto story266 = Story266();
+thread_local auto story267 = Story267();
+thread_local auto story268 = Story268();
+thread_local auto story269 = Story269();
+thread_local auto story270 = Story270();
+thread_local auto story271 = Story271();
+thread_local auto story272 = Story272();
+thread_local auto story273 = Story273();
+thread_local auto story274 = Story274();
+thread_local auto story275 = Story275();
+thread_local auto story276 = Story276();
+thread_local auto story277 = Story277();
+thread_local auto story278 = Story278();
+thread_local auto story279 = Story279();
+thread_local auto story280 = Story280();
+thread_local auto story281 = Story281();
+thread_local auto story282 = Story282();
+thread_local auto story283 = Story283();
+thread_local auto story284 = Story284();
+thread_local auto story285 = Story285();
+thread_local auto story286 = Story286();
+thread_local auto story287 = Story287();
+thread_local auto story288 = Story288();
+thread_local auto story289 = Story289();
+thread_local auto story290 = Story290();
+thread_local auto story291 = Story291();
+thread_local auto story292 = Story292();
+thread_local auto story293 = Story293();
+thread_local auto story294 = Story294();
+thread_local auto story295 = Story295();
+thread_local auto story296 = Story296();
+thread_local auto story297 = Story297();
+thread_local auto story298 = Story298();
+thread_local auto story299 = Story299();
+thread_local auto story300 = Story300();
+thread_local auto story301 = Story301();
+thread_local auto story302 = Story302();
+thread_local auto story303 = Story303();
+thread_local auto story304 = Story304();
+thread_local auto story305 = Story305();
+thread_local auto story306 = Story306();
+thread_local auto story307 = Story307();
+thread_local auto story308 = Story308();
+thread_local auto story309 = Story309();
+thread_local auto story310 = Story310();
+thread_local auto event310 = Event310();
+thread_local auto story311 = Story311();
+thread_local auto story312 = Story312();
+thread_local auto story313 = Story313();
+thread_local auto story314 = Story314();
+thread_local auto story315 = Story315();
+thread_local auto story316 = Story316();
+thread_local auto event316 = Event316();
+thread_local auto story317 = Story317();
+thread_local auto story318 = Story318();
+thread_local auto story319 = Story319();
+thread_local auto story320 = Story320();
+thread_local auto story321 = Story321();
+thread_local auto story322 = Story322();
+thread_local auto story323 = Story323();
+thread_local auto story324 = Story324();
+thread_local auto story325 = Story325();
+thread_local auto story326 = Story326();
+thread_local auto story327 = Story327();
+thread_local auto story328 = Story328();
+thread_local auto story329 = Story329();
+thread_local auto story330 = Story330();
+thread_local auto story331 = Story331();
+thread_local auto story332 = Story332();
+thread_local auto story333 = Story333();
+thread_local auto story334 = Story334();
+thread_local auto event335 = Event335();
+thread_local auto story335 = Story335();
+thread_local auto story336 = Story336();
+thread_local auto story337 = Story337();
+thread_local auto story338 = Story338();
+thread_local auto story339 = Story339();
+thread_local auto story340 = Story340();
+thread_local auto story341 = Story341();
+thread_local auto story342 = Story342();
+thread_local auto story343 = Story343();
+thread_local auto story344 = Story344();
+thread_local auto story345 = Story345();
+thread_local auto story346 = Story346();
+thread_local auto story347 = Story347();
+thread_local auto story348 = Story348();
+thread_local auto story349 = Story349();
+thread_local auto story350 = Story350();
+thread_local auto story351 = Story351();
+thread_local auto story352 = Story352();
+thread_local auto story353 = Story353();
+thread_local auto story354 = Story354();
+thread_local auto event354 = Event354();
+thread_local auto story355 = Story355();
+thread_local auto story356 = Story356();
+thread_local auto story357 = Story357();
+thread_local auto story358 = Story358();
+thread_local auto story359 = Story359();
+thread_local auto story360 = Story360();
+thread_local auto story361 = Story361();
+thread_local auto story362 = Story362();
+thread_local auto story363 = Story363();
+thread_local auto story364 = Story364();
+thread_local auto story365 = Story365();
+thread_local auto story366 = Story366();
+thread_local auto story367 = Story367();
+thread_local auto story368 = Story368();
+thread_local auto story369 = Story369();
+thread_local auto story370 = Story370();
+thread_local auto story371 = Story371();
+thread_local auto story372 = Story372();
+thread_local auto story373 = Story373();
+thread_local auto story374 = Story374();
+thread_local auto story375 = Story375();
+thread_local auto story376 = Story376();
+thread_local auto story377 = Story377();
+thread_local auto story378 = Story378();
+thread_local auto story379 = Story379();
+thread_local auto story380 = Story380();
+thread_local auto story381 = Story381();
+thread_local auto story382 = Story382();
+thread_local auto story383 = Story383();
+thread_local auto story384 = Story384();
+thread_local auto story385 = Story385();
+thread_local auto story386 = Story386();
+thread_local auto story387 = Story387();
+thread_local auto story388 = Story388();
+thread_local auto story389 = Story389();
+thread_local auto story390 = Story390();
+thread_local auto story391 = Story391();
+thread_local auto story392 = Story392();
+thread_local auto story393 = Story393();
+thread_local auto story394 = Story394();
+thread_local auto story395 = Story395();
+thread_local auto story396 = Story396();
+thread_local auto story397 = Story397();
+thread_local auto story398 = Story398();
+thread_local auto story399 = Story399();
+thread_local auto story400 = Story400();
+thread_local auto story401 = Story401();
+thread_local auto story402 = Story402();
+thread_local auto story403 = Story403();
+thread_local auto story404 = Story404();
+thread_local auto story405 = Story405();
+thread_local auto story406 = Story406();
+thread_local auto story407 = Story407();
+thread_local auto story408 = Story408();
+thread_local auto story409 = Story409();
+thread_local auto story410 = Story410();
+thread_local auto story411 = Story411();
+thread_local auto story412 = Story412();
+thread_local auto story413 = Story413();
+thread_local auto story414 = Story414();
+thread_local auto story415 = Story415();
+thread_local auto story416 = Story416();
+thread_local auto story417 = Story417();
+thread_local auto story418 = Story418();
+thread_local auto story419 = Story419();
+thread_local auto story420 = Story420();
+thread_local auto story421 = Story421();
+thread_local auto story422 = Story422();
+thread_local auto story423 = Story423();
+thread_local auto story424 = Story424();
+thread_local auto story425 = Story425();
+thread_local auto story426 = Story426();
+thread_local auto story427 = Story427();
 
 void InitializeStories()
 {
@@ -11497,6 +11191,18 @@ void InitializeStories()
         &story400, &story401, &story402, &story403, &story404, &story405, &story406, &story407, &story408, &story409,
         &story410, &story411, &story412, &story413, &story414, &story415, &story416, &story417, &story418, &story419,
         &story420, &story421, &story422, &story423, &story424, &story425, &story426, &story427};
+
+    Sections = std::vector<Story::Base *>(StoryGraph::SECTIONS, NULL);
+
+    for (auto i = 0; i < Stories.size(); i++)
+    {
+        auto index = StoryGraph::INDEX(Stories[i]->ID);
+
+        if (index >= 0)
+        {
+            Sections[index] = Stories[i];
+        }
+    }
 }
 
 #endif
@@ -0,0 +1,431 @@
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <queue>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Build step: reads the section classes in story.hpp without running them and writes the section graph out as storygraph.hpp,
+// failing when a choice, background jump or continue leads to a section that does not exist or a section that is not an ending
+// leads nowhere
+namespace Generator
+{
+    enum class Edge
+    {
+        CHOICE = 0,
+        BACKGROUND,
+        CONTINUE
+    };
+
+    const char *Edges[] = {"CHOICE", "BACKGROUND", "CONTINUE"};
+
+    class Section
+    {
+    public:
+        std::string Class = std::string();
+
+        int ID = 0;
+
+        bool Defined = false;
+
+        // line of the class in story.hpp, for messages
+        int Line = 0;
+
+        std::set<std::pair<int, Generator::Edge>> Edges = std::set<std::pair<int, Generator::Edge>>();
+
+        // the class has choices, or a Background or Continue of its own whatever it returns
+        bool Choices = false;
+
+        bool Continue = false;
+
+        // the section sets a Type other than NORMAL, at least some of the time
+        bool Ending = false;
+    };
+
+    // blanks out string and character literals and drops line comments, so braces and numbers in text are not mistaken for code
+    std::string CODE(const std::string &line)
+    {
+        auto code = std::string();
+
+        for (auto i = 0; i < line.size(); i++)
+        {
+            auto c = line[i];
+
+            if (c == '"' || c == '\'')
+            {
+                code += c;
+
+                for (i++; i < line.size() && line[i] != c; i++)
+                {
+                    if (line[i] == '\\')
+                    {
+                        i++;
+                    }
+                }
+
+                code += c;
+            }
+            else if (c == '/' && i + 1 < line.size() && line[i + 1] == '/')
+            {
+                break;
+            }
+            else
+            {
+                code += c;
+            }
+        }
+
+        return code;
+    }
+
+    std::string WRAP(const std::vector<int> &values)
+    {
+        auto text = std::ostringstream();
+
+        for (auto i = 0; i < values.size(); i++)
+        {
+            text << (i % 20 == 0 ? "\n        " : " ") << values[i] << ",";
+        }
+
+        return text.str();
+    }
+
+    int GENERATE(const char *input, const char *output)
+    {
+        std::ifstream ifs(input);
+
+        if (!ifs.good())
+        {
+            std::fprintf(stderr, "storygraph: cannot read %s\n", input);
+
+            return 1;
+        }
+
+        auto classes = std::map<std::string, Generator::Section>();
+
+        auto variables = std::map<std::string, std::string>();
+
+        auto registered = std::vector<std::string>();
+
+        auto class_pattern = std::regex("class (\\w+) : public Story::Base");
+        auto id_pattern = std::regex("\\bID = (-?\\d+);");
+        auto method_pattern = std::regex("\\bint (Background|Continue)\\s*\\(");
+        auto return_pattern = std::regex("\\breturn (-?\\d+);");
+        auto choice_pattern = std::regex("Choice::Base\\(\"\",\\s*(-?\\d+)");
+        auto destination_pattern = std::regex("\\.Destination = (-?\\d+);");
+        auto variable_pattern = std::regex("thread_local auto (\\w+) = (\\w+)\\(\\);");
+        auto member_pattern = std::regex("&(\\w+)");
+        auto type_pattern = std::regex("\\bType = Story::Type::(\\w+);");
+
+        auto current = std::string();
+
+        auto method = Generator::Edge::CHOICE;
+
+        auto in_method = false;
+
+        // the method's own opening brace has been seen, it may be on the next line
+        auto method_open = false;
+
+        auto method_depth = 0;
+
+        auto depth = 0;
+
+        auto in_stories = false;
+
+        auto number = 0;
+
+        auto line = std::string();
+
+        while (std::getline(ifs, line))
+        {
+            number++;
+
+            auto code = Generator::CODE(line);
+
+            auto match = std::smatch();
+
+            if (std::regex_search(code, match, class_pattern))
+            {
+                current = match[1];
+
+                classes[current].Class = current;
+
+                classes[current].Line = number;
+            }
+            else if (!current.empty() && !classes[current].Defined && std::regex_search(code, match, id_pattern))
+            {
+                classes[current].ID = std::stoi(match[1]);
+
+                classes[current].Defined = true;
+            }
+
+            if (std::regex_search(code, match, method_pattern))
+            {
+                method = match[1] == "Background" ? Generator::Edge::BACKGROUND : Generator::Edge::CONTINUE;
+
+                in_method = true;
+
+                method_open = false;
+
+                if (!current.empty())
+                {
+                    classes[current].Continue = true;
+                }
+
+                method_depth = depth;
+            }
+
+            if (!current.empty())
+            {
+                for (auto it = std::sregex_iterator(code.begin(), code.end(), choice_pattern); it != std::sregex_iterator(); it++)
+                {
+                    classes[current].Edges.insert({std::stoi((*it)[1]), Generator::Edge::CHOICE});
+
+                    classes[current].Choices = true;
+                }
+
+                for (auto it = std::sregex_iterator(code.begin(), code.end(), destination_pattern); it != std::sregex_iterator(); it++)
+                {
+                    classes[current].Edges.insert({std::stoi((*it)[1]), Generator::Edge::CHOICE});
+
+                    classes[current].Choices = true;
+                }
+
+                if (std::regex_search(code, match, type_pattern) && match[1] != "NORMAL")
+                {
+                    classes[current].Ending = true;
+                }
+
+                if (in_method)
+                {
+                    for (auto it = std::sregex_iterator(code.begin(), code.end(), return_pattern); it != std::sregex_iterator(); it++)
+                    {
+                        auto target = std::stoi((*it)[1]);
+
+                        // -1 stays in the section
+                        if (target != -1)
+                        {
+                            classes[current].Edges.insert({target, method});
+                        }
+                    }
+                }
+            }
+
+            if (std::regex_search(code, match, variable_pattern))
+            {
+                variables[match[1]] = match[2];
+            }
+
+            if (code.find("void InitializeStories()") != std::string::npos)
+            {
+                in_stories = true;
+            }
+
+            if (in_stories)
+            {
+                for (auto it = std::sregex_iterator(code.begin(), code.end(), member_pattern); it != std::sregex_iterator(); it++)
+                {
+                    registered.push_back((*it)[1]);
+                }
+            }
+
+            depth += std::count(code.begin(), code.end(), '{') - std::count(code.begin(), code.end(), '}');
+
+            method_open |= in_method && code.find('{') != std::string::npos;
+
+            if (in_method && method_open && depth <= method_depth)
+            {
+                in_method = false;
+            }
+
+            if (in_stories && depth == 0 && code.find('}') != std::string::npos)
+            {
+                in_stories = false;
+            }
+        }
+
+        auto errors = 0;
+
+        // sections the game can actually reach, by ID
+        auto sections = std::map<int, Generator::Section *>();
+
+        for (auto i = 0; i < registered.size(); i++)
+        {
+            auto variable = variables.find(registered[i]);
+
+            auto section = variable != variables.end() ? classes.find(variable->second) : classes.end();
+
+            if (section == classes.end() || !section->second.Defined)
+            {
+                std::fprintf(stderr, "storygraph: %s is registered but is not a section\n", registered[i].c_str());
+
+                errors++;
+            }
+            else if (sections.count(section->second.ID) > 0)
+            {
+                std::fprintf(stderr, "storygraph: %s and %s share ID %d\n", sections[section->second.ID]->Class.c_str(), section->second.Class.c_str(), section->second.ID);
+
+                errors++;
+            }
+            else
+            {
+                sections[section->second.ID] = &section->second;
+            }
+        }
+
+        for (auto &section : classes)
+        {
+            if (section.second.Defined && section.second.ID >= 0 && sections.count(section.second.ID) == 0)
+            {
+                std::fprintf(stderr, "storygraph: %s (line %d) is never registered in InitializeStories\n", section.second.Class.c_str(), section.second.Line);
+            }
+        }
+
+        auto edges = 0;
+
+        for (auto &section : sections)
+        {
+            for (auto &edge : section.second->Edges)
+            {
+                if (sections.count(edge.first) == 0)
+                {
+                    std::fprintf(stderr, "storygraph: %s (line %d) has a %s edge to %d, which does not exist\n", section.second->Class.c_str(), section.second->Line, Generator::Edges[(int)edge.second], edge.first);
+
+                    errors++;
+                }
+
+                edges++;
+            }
+
+            // the player would be left on the section with nothing to press
+            if (!section.second->Choices && !section.second->Continue && !section.second->Ending)
+            {
+                std::fprintf(stderr, "storygraph: %s (line %d) has no choices, no Continue and is not an ending\n", section.second->Class.c_str(), section.second->Line);
+
+                errors++;
+            }
+        }
+
+        if (errors > 0 || sections.count(0) == 0)
+        {
+            std::fprintf(stderr, "storygraph: %d error(s), %s not written\n", errors, output);
+
+            return 1;
+        }
+
+        auto reached = std::set<int>({0});
+
+        auto queue = std::queue<int>();
+
+        queue.push(0);
+
+        while (!queue.empty())
+        {
+            auto id = queue.front();
+
+            queue.pop();
+
+            for (auto &edge : sections[id]->Edges)
+            {
+                if (reached.insert(edge.first).second)
+                {
+                    queue.push(edge.first);
+                }
+            }
+        }
+
+        auto ids = std::vector<int>();
+
+        auto offsets = std::vector<int>({0});
+
+        auto targets = std::vector<int>();
+
+        auto kinds = std::vector<int>();
+
+        auto unreachable = std::vector<int>();
+
+        for (auto &section : sections)
+        {
+            ids.push_back(section.first);
+
+            for (auto &edge : section.second->Edges)
+            {
+                targets.push_back(edge.first);
+
+                kinds.push_back((int)edge.second);
+            }
+
+            offsets.push_back(targets.size());
+
+            if (reached.count(section.first) == 0)
+            {
+                unreachable.push_back(section.first);
+
+                std::fprintf(stderr, "storygraph: %s cannot be reached from the prologue\n", section.second->Class.c_str());
+            }
+        }
+
+        auto header = std::ostringstream();
+
+        header << "#ifndef __STORYGRAPH__HPP__\n#define __STORYGRAPH__HPP__\n\n";
+        header << "// Generated from story.hpp by storygraph.cpp, do not edit: run make graph instead\n";
+        header << "namespace StoryGraph\n{\n";
+        header << "    enum class Edge\n    {\n        CHOICE = 0,\n        BACKGROUND,\n        CONTINUE\n    };\n\n";
+        header << "    const int SECTIONS = " << ids.size() << ";\n\n";
+        header << "    const int EDGES = " << targets.size() << ";\n\n";
+        header << "    // every section in ascending order of ID\n";
+        header << "    constexpr int IDS[] = {" << Generator::WRAP(ids) << "};\n\n";
+        header << "    // the edges of IDS[i] are TARGETS[OFFSETS[i]] up to TARGETS[OFFSETS[i + 1]]\n";
+        header << "    constexpr int OFFSETS[] = {" << Generator::WRAP(offsets) << "};\n\n";
+        header << "    constexpr int TARGETS[] = {" << Generator::WRAP(targets) << "};\n\n";
+        header << "    // StoryGraph::Edge of each target\n";
+        header << "    constexpr unsigned char KINDS[] = {" << Generator::WRAP(kinds) << "};\n\n";
+        header << "    const int UNREACHABLE = " << unreachable.size() << ";\n\n";
+        header << "    // sections no path from the prologue leads to, a trailing 0 keeps the array from being empty\n";
+        header << "    constexpr int UNREACHED[] = {" << Generator::WRAP(unreachable) << "\n        0};\n\n";
+        header << "    // position of a section in IDS, -1 if there is no such section\n";
+        header << "    constexpr int INDEX(int id)\n    {\n";
+        header << "        auto low = 0;\n\n        auto high = StoryGraph::SECTIONS - 1;\n\n";
+        header << "        while (low <= high)\n        {\n";
+        header << "            auto middle = (low + high) / 2;\n\n";
+        header << "            if (StoryGraph::IDS[middle] == id)\n            {\n                return middle;\n            }\n";
+        header << "            else if (StoryGraph::IDS[middle] < id)\n            {\n                low = middle + 1;\n            }\n";
+        header << "            else\n            {\n                high = middle - 1;\n            }\n        }\n\n";
+        header << "        return -1;\n    }\n\n";
+        header << "    static_assert(StoryGraph::INDEX(0) >= 0, \"the prologue has to be in the graph\");\n";
+        header << "} // namespace StoryGraph\n\n#endif\n";
+
+        // only touch the header when the graph changed so that make does not rebuild for nothing
+        std::ifstream existing(output);
+
+        auto previous = std::string(std::istreambuf_iterator<char>(existing), std::istreambuf_iterator<char>());
+
+        if (previous != header.str())
+        {
+            std::ofstream ofs(output);
+
+            ofs << header.str();
+        }
+
+        std::printf("storygraph: %zu sections, %zu edges, %zu unreachable\n", ids.size(), targets.size(), unreachable.size());
+
+        return 0;
+    }
+} // namespace Generator
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        std::fprintf(stderr, "Usage: %s <story.hpp> <storygraph.hpp>\n", argv[0]);
+
+        return 1;
+    }
+
+    return Generator::GENERATE(argv[1], argv[2]);
+}
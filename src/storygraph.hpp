@@ -0,0 +1,197 @@
+#ifndef __STORYGRAPH__HPP__
+#define __STORYGRAPH__HPP__
+
+// Generated from story.hpp by storygraph.cpp, do not edit: run make graph instead
+namespace StoryGraph
+{
+    enum class Edge
+    {
+        CHOICE = 0,
+        BACKGROUND,
+        CONTINUE
+    };
+
+    const int SECTIONS = 436;
+
+    const int EDGES = 853;
+
+    // every section in ascending order of ID
+    constexpr int IDS[] = {
+        -354, -335, -316, -310, -225, -167, -117, -59, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+        12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+        32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+        52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+        72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91,
+        92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+        112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+        132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+        152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171,
+        172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+        192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211,
+        212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231,
+        232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+        252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+        272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291,
+        292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311,
+        312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331,
+        332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+        352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371,
+        372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391,
+        392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
+        412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427,};
+
+    // the edges of IDS[i] are TARGETS[OFFSETS[i]] up to TARGETS[OFFSETS[i + 1]]
+    constexpr int OFFSETS[] = {
+        0, 4, 8, 12, 13, 13, 16, 17, 18, 19, 22, 24, 24, 27, 28, 29, 31, 33, 35, 36,
+        37, 43, 44, 45, 46, 47, 48, 49, 51, 54, 56, 57, 57, 59, 61, 63, 65, 69, 71, 74,
+        79, 80, 83, 87, 88, 89, 90, 92, 93, 96, 97, 99, 100, 101, 102, 103, 106, 108, 110, 112,
+        113, 118, 120, 121, 122, 123, 124, 125, 127, 128, 130, 131, 132, 137, 138, 141, 143, 146, 147, 148,
+        151, 152, 153, 154, 156, 157, 160, 163, 164, 166, 169, 170, 174, 177, 179, 181, 185, 191, 196, 200,
+        201, 203, 203, 207, 208, 209, 211, 212, 213, 216, 218, 219, 221, 224, 227, 228, 230, 231, 233, 236,
+        236, 237, 239, 240, 243, 245, 247, 251, 252, 253, 255, 257, 258, 259, 260, 261, 267, 268, 272, 273,
+        275, 276, 277, 280, 283, 286, 288, 292, 293, 294, 297, 299, 301, 302, 303, 306, 307, 308, 311, 312,
+        313, 314, 315, 320, 321, 323, 324, 325, 326, 329, 331, 335, 336, 344, 347, 348, 349, 350, 351, 352,
+        353, 357, 361, 363, 364, 365, 368, 370, 373, 374, 375, 377, 378, 379, 380, 383, 384, 385, 386, 387,
+        390, 392, 394, 395, 396, 398, 400, 402, 404, 405, 409, 417, 420, 421, 422, 423, 425, 425, 428, 429,
+        431, 433, 435, 438, 439, 440, 443, 444, 445, 445, 446, 448, 449, 450, 452, 454, 454, 455, 456, 458,
+        459, 461, 464, 465, 467, 468, 469, 471, 473, 473, 477, 478, 479, 481, 482, 485, 486, 487, 490, 492,
+        495, 500, 504, 505, 509, 511, 514, 514, 515, 516, 517, 519, 520, 520, 522, 524, 525, 527, 530, 531,
+        534, 538, 541, 542, 543, 544, 545, 553, 555, 557, 557, 558, 559, 561, 562, 563, 565, 566, 569, 574,
+        576, 578, 580, 582, 583, 584, 588, 588, 591, 594, 595, 597, 599, 600, 601, 602, 604, 607, 608, 610,
+        613, 614, 615, 616, 617, 619, 622, 623, 626, 627, 628, 631, 632, 632, 633, 636, 640, 641, 643, 646,
+        647, 649, 650, 651, 653, 655, 658, 663, 665, 667, 670, 671, 675, 678, 679, 680, 683, 685, 687, 687,
+        689, 691, 692, 694, 698, 699, 702, 703, 704, 707, 708, 710, 713, 714, 720, 722, 724, 725, 726, 730,
+        731, 732, 736, 739, 740, 743, 744, 747, 749, 754, 757, 759, 761, 763, 766, 766, 767, 769, 771, 775,
+        776, 780, 782, 783, 784, 785, 786, 788, 790, 795, 797, 798, 800, 803, 804, 804, 807, 808, 812, 814,
+        815, 815, 820, 822, 823, 825, 826, 827, 831, 835, 837, 840, 847, 849, 850, 853, 853,};
+
+    constexpr int TARGETS[] = {
+        316, 335, 373, 392, 316, 354, 373, 392, 335, 354, 373, 392, 370, 261, 299, 318, 98, 9, 1, 20,
+        39, 172, 222, 421, 42, 61, 288, 195, 89, 26, 26, 46, 65, 406, 423, 10, 108, 31, 50, 69,
+        88, 107, 409, 70, 362, 289, 184, 396, 94, 6, 227, 39, 77, 172, 58, 97, 98, 92, 111, 6,
+        227, 45, 64, 46, 65, 6, 47, 85, 104, 67, 105, 49, 68, 87, 316, 335, 354, 373, 392, 392,
+        52, 90, 374, 72, 91, 110, 129, 16, 396, 94, 227, 415, 172, 28, 47, 66, 116, 80, 267, 14,
+        184, 64, 65, 218, 237, 275, 67, 105, 144, 163, 69, 107, 392, 128, 147, 166, 185, 204, 148, 167,
+        16, 396, 414, 6, 97, -59, 9, 22, 267, 288, 157, 14, 83, 102, 121, 140, 159, 84, 135, 174,
+        193, 105, 124, 49, 87, 144, 107, 392, 33, 52, 374, 203, 225, 366, 113, 132, 171, 96, 115, 172,
+        150, 169, 188, 116, 267, 288, 5, 62, 100, 14, 102, 121, 140, 159, 103, 122, 141, 123, 142, 143,
+        162, 182, 201, 315, 334, 164, 183, 202, 221, 278, 297, 76, 95, 114, 133, 152, 52, 109, 374, 385,
+        205, 130, 149, 151, 170, 189, 208, 171, 172, 116, 173, 116, 23, 6, 62, 176, 10, 120, 178, 122,
+        141, 47, 66, 85, 86, 143, 162, 370, 126, 145, 9, 52, 374, 261, 299, 318, 321, 94, 227, 171,
+        134, 153, 191, 155, 426, -117, 41, 137, 194, 213, 232, 137, 370, 178, 197, 141, 160, 161, 105, 106,
+        145, 12, 31, 69, 88, 107, 409, 223, 72, 224, 243, 262, 111, 283, 302, 94, 171, 191, 210, 229,
+        212, 212, 231, 156, 386, 405, 156, 175, 18, 37, 75, 397, 217, 178, 179, 198, 217, 180, 199, 181,
+        200, 177, 165, 13, 32, 51, 223, 337, 168, 187, 206, 16, 246, 171, 172, 177, 196, 215, 253, 272,
+        426, 154, 177, 137, 389, 178, 135, 349, 386, 47, 66, 219, 238, 257, 276, 87, 12, 31, 50, 69,
+        107, 202, 278, 409, 336, 355, 374, 374, -167, 16, 347, 246, 361, 289, 381, 399, 416, 116, 192, 211,
+        230, 250, 269, 156, 195, 367, 386, 404, 135, 235, 236, 255, 388, 161, 332, 201, 220, 392, 320, 223,
+        78, 347, 413, 301, 347, 246, 209, 248, 286, 305, 116, 211, 135, 174, 251, 137, 177, 215, 173, 173,
+        274, 293, 47, 66, 332, 240, 372, 391, 408, 12, 31, 50, 69, 107, 164, 278, 409, 261, 299, 318,
+        223, 184, 225, 97, 396, 228, 247, 266, 172, 116, 249, 118, 137, 137, 194, 16, 24, 252, 177, 273,
+        236, 255, 388, 256, 295, 126, 7, 259, 374, 205, -225, 16, 16, 396, 323, 172, 268, 287, 212, 137,
+        194, 34, 53, 72, 272, 216, 254, 136, 256, 276, 314, 165, 406, 119, 271, 290, 309, 343, 205, 69,
+        107, 16, 265, 284, 303, 323, 172, 116, 306, 325, 135, 288, 308, 327, 346, 35, 54, 73, 263, 282,
+        196, 215, 234, 291, 273, 331, 350, 369, 388, 294, 313, 219, 238, 276, 26, 244, 184, 72, 281, 16,
+        322, 341, 285, 304, 23, 116, 211, 288, 307, 326, 400, 5, 317, 384, 177, 310, 329, 348, 292, 311,
+        330, 217, 256, 332, 120, 12, 31, 50, 69, 107, 164, 202, 409, 46, 65, 203, 233, 73, 321, 322,
+        341, 171, 172, 116, 211, 135, 2, 21, 40, 5, 271, 309, 317, 384, 215, 272, 311, 330, 139, 217,
+        29, 48, 332, 116, 146, 183, 221, 392, 337, 356, 375, 319, 338, 357, 184, 16, 396, 190, 209, 171,
+        172, 344, 364, 383, 137, 327, 346, 157, -310, 272, 330, 353, 422, 59, 332, 276, 177, -316, 392, 5,
+        241, 384, 300, 186, 339, 358, 138, 340, 227, 360, 379, 342, 344, 4, 99, 267, 5, 119, 365, 384,
+        137, 30, 348, 135, 349, 386, 136, 135, 351, 352, 367, -335, 392, 393, 410, 184, 394, 411, 56, 207,
+        357, 359, 378, 357, 377, 16, 396, 19, 38, 57, 427, 261, 280, 299, 318, 363, 382, 400, 135, 327,
+        226, 245, 264, 239, 258, 368, 387, 158, 389, 371, 425, 330, -354, 392, 33, 52, 71, 374, 184, 376,
+        395, 412, 396, 414, 227, 398, 415, 427, 242, 324, 5, 270, 296, 135, 5, 241, 317, 384, 402, 419,
+        112, 131, 106, 125, 405, 136, 380, 390, 403, 420, 424, 177, 316, 335, 354, 392, 43, 63, 82, 300,
+        24, 214, 252, 396, 56, 93, 396, 25, 415, 11, 148, 390, 403, 420, 289, 399, 416, 363, 417, 345,
+        401, 62, 81, 52, 109, 374, 405, 312, 350, 407, 424, 108, 380, 403, 420, 367, 50, 69, 107, 409,
+        355, 374, 184, 376, 184, 94, 227, 415, 289, 416, 22, 41, 60, 79, 117, 298, 418, 328, 11, 108,
+        106, 120, 277, 9, 333, 352, 371, 177, 69, 107, 244, 260, 355, 374, 184, 17, 36, 55, 74, 366,
+        44, 376, 89, 15, 289, 116, 135, 5, 241, 317, 384, 108, 380, 390, 403, 7, 259, 8, 27, 279,
+        12, 31, 50, 69, 88, 127, 409, 101, 120, 370, 135, 174, 193,};
+
+    // StoryGraph::Edge of each target
+    constexpr unsigned char KINDS[] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 1, 2, 0,
+        0, 0, 2, 2, 0, 2, 0, 2, 2, 1, 2, 0, 0, 1, 1, 2, 2, 0, 0, 0,
+        0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+        0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 2, 1, 2, 2,
+        2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+        2, 2, 2, 2, 2, 0, 0, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 2, 0, 0,
+        2, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 2, 2, 2, 0, 0, 2, 0, 0, 0,
+        0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 2,
+        2, 1, 1, 0, 0, 2, 0, 2, 2, 0, 0, 0, 2, 0, 0, 2, 0, 0, 2, 2,
+        2, 0, 0, 0, 2, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+        0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 2, 2, 2,
+        2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 2, 2, 0, 0, 0,
+        0, 2, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2,
+        2, 2, 2, 0, 0, 0, 2, 2, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 2, 0,
+        2, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+        0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 2, 1, 2,
+        0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 2,
+        0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2, 2, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2,
+        2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 0, 0, 2, 0,
+        0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 2, 2,
+        2, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 2,
+        0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+        0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0,
+        0, 2, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+        0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2,
+        2, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0,
+        0, 0, 2, 0, 0, 0, 2, 2, 2, 0, 0, 2, 2, 0, 2, 0, 0, 0, 0, 0,
+        2, 1, 1, 0, 0, 0, 2, 0, 0, 2, 2, 0, 0, 2, 2, 0, 2, 0, 0, 0,
+        0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+        2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 0,
+        0, 0, 2, 2, 2, 0, 0, 2, 2, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+        0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2,
+        0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 2,
+        2, 0, 0, 0, 2, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+        0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0, 0,
+        2, 2, 2, 2, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+        0, 0, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0,
+        0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 2,};
+
+    const int UNREACHABLE = 1;
+
+    // sections no path from the prologue leads to, a trailing 0 keeps the array from being empty
+    constexpr int UNREACHED[] = {
+        3,
+        0};
+
+    // position of a section in IDS, -1 if there is no such section
+    constexpr int INDEX(int id)
+    {
+        auto low = 0;
+
+        auto high = StoryGraph::SECTIONS - 1;
+
+        while (low <= high)
+        {
+            auto middle = (low + high) / 2;
+
+            if (StoryGraph::IDS[middle] == id)
+            {
+                return middle;
+            }
+            else if (StoryGraph::IDS[middle] < id)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle - 1;
+            }
+        }
+
+        return -1;
+    }
+
+    static_assert(StoryGraph::INDEX(0) >= 0, "the prologue has to be in the graph");
+} // namespace StoryGraph
+
+#endif
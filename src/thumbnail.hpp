@@ -0,0 +1,129 @@
+#ifndef __THUMBNAIL__HPP__
+#define __THUMBNAIL__HPP__
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "binary.hpp"
+
+// A small picture of the story screen kept with each save, so the load screen can show where the game was left
+namespace Thumbnail
+{
+    // size thumbnails are stored at, whatever the size of the window they were taken from
+    const int WIDTH = 96;
+
+    const int HEIGHT = 54;
+
+    // 24-bit RGB, rows top to bottom with no padding between them
+    class Image
+    {
+    public:
+        int Width = 0;
+
+        int Height = 0;
+
+        std::vector<std::uint8_t> Pixels = std::vector<std::uint8_t>();
+
+        Image()
+        {
+        }
+
+        Image(int width, int height) : Width(width), Height(height), Pixels(std::vector<std::uint8_t>(width * height * 3))
+        {
+        }
+
+        bool EMPTY() const
+        {
+            return Width <= 0 || Height <= 0 || Pixels.size() < Width * Height * 3;
+        }
+    };
+
+    // every pixel of the thumbnail is the average of the block of the frame it covers
+    Thumbnail::Image SHRINK(const Thumbnail::Image &frame, int width, int height)
+    {
+        if (frame.EMPTY() || width <= 0 || height <= 0)
+        {
+            return Thumbnail::Image();
+        }
+
+        auto image = Thumbnail::Image(width, height);
+
+        for (auto y = 0; y < height; y++)
+        {
+            auto top = y * frame.Height / height;
+
+            auto bottom = std::max(top + 1, (y + 1) * frame.Height / height);
+
+            for (auto x = 0; x < width; x++)
+            {
+                auto left = x * frame.Width / width;
+
+                auto right = std::max(left + 1, (x + 1) * frame.Width / width);
+
+                std::uint32_t sum[3] = {0, 0, 0};
+
+                for (auto row = top; row < bottom; row++)
+                {
+                    auto pixel = &frame.Pixels[(row * frame.Width + left) * 3];
+
+                    for (auto column = left; column < right; column++, pixel += 3)
+                    {
+                        sum[0] += pixel[0];
+
+                        sum[1] += pixel[1];
+
+                        sum[2] += pixel[2];
+                    }
+                }
+
+                auto count = (bottom - top) * (right - left);
+
+                for (auto channel = 0; channel < 3; channel++)
+                {
+                    image.Pixels[(y * width + x) * 3 + channel] = (std::uint8_t)((sum[channel] + count / 2) / count);
+                }
+            }
+        }
+
+        return image;
+    }
+
+    std::string ENCODE(const Thumbnail::Image &image)
+    {
+        auto writer = Binary::Writer();
+
+        writer.UNSIGNED(image.Width);
+
+        writer.UNSIGNED(image.Height);
+
+        writer.Bytes.append((const char *)image.Pixels.data(), image.Width * image.Height * 3);
+
+        return writer.Bytes;
+    }
+
+    bool DECODE(const std::uint8_t *data, std::size_t size, Thumbnail::Image &image)
+    {
+        auto reader = Binary::Reader(data, size);
+
+        auto width = reader.UNSIGNED();
+
+        auto height = reader.UNSIGNED();
+
+        // no larger than a thumbnail can be, so a damaged size cannot ask for a huge picture
+        if (!reader.Good || width == 0 || height == 0 || width > Thumbnail::WIDTH * 4 || height > Thumbnail::HEIGHT * 4 || size - reader.Position != width * height * 3)
+        {
+            return false;
+        }
+
+        image = Thumbnail::Image(width, height);
+
+        std::copy(data + reader.Position, data + size, image.Pixels.begin());
+
+        return true;
+    }
+
+} // namespace Thumbnail
+
+#endif
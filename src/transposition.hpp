@@ -0,0 +1,149 @@
+#ifndef __TRANSPOSITION__HPP__
+#define __TRANSPOSITION__HPP__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Fixed-size hash table of game states shared by worker threads without locks
+namespace Transposition
+{
+    // Check holds the key XOR-ed with Data, a slot torn by two writers no longer matches its key and reads as a miss
+    class Entry
+    {
+    public:
+        std::atomic<std::uint64_t> Check = {0};
+
+        std::atomic<std::uint64_t> Data = {0};
+    };
+
+    // Data packs a 32-bit value, a 16-bit depth and a 16-bit generation
+    constexpr std::uint64_t PACK(int value, int depth, int generation)
+    {
+        return ((std::uint64_t)(std::uint32_t)value << 32) | ((std::uint64_t)(std::uint16_t)depth << 16) | (std::uint16_t)generation;
+    }
+
+    constexpr int VALUE(std::uint64_t data)
+    {
+        return (int)(std::uint32_t)(data >> 32);
+    }
+
+    constexpr int DEPTH(std::uint64_t data)
+    {
+        return (int)(std::uint16_t)(data >> 16);
+    }
+
+    constexpr int GENERATION(std::uint64_t data)
+    {
+        return (int)(std::uint16_t)data;
+    }
+
+    // buckets of two slots: the first keeps the deepest entry of the current generation, the second is always replaced
+    class Table
+    {
+    public:
+        std::unique_ptr<Transposition::Entry[]> Entries;
+
+        std::uint64_t Mask = 0;
+
+        // starts at 1 so that an empty slot never looks like a stored entry
+        std::atomic<int> Generation = {1};
+
+        std::atomic<long long> Probes = {0};
+
+        std::atomic<long long> Hits = {0};
+
+        std::atomic<long long> Stores = {0};
+
+        // stores that evicted another state
+        std::atomic<long long> Replacements = {0};
+
+        // 2^bits buckets
+        Table(int bits) : Entries(new Transposition::Entry[(std::size_t)2 << bits]), Mask(((std::uint64_t)1 << bits) - 1)
+        {
+        }
+
+        bool PROBE(std::uint64_t key, int &value, int &depth)
+        {
+            Probes.fetch_add(1, std::memory_order_relaxed);
+
+            auto bucket = &Entries[(key & Mask) * 2];
+
+            for (auto i = 0; i < 2; i++)
+            {
+                auto data = bucket[i].Data.load(std::memory_order_relaxed);
+
+                if (data != 0 && (bucket[i].Check.load(std::memory_order_relaxed) ^ data) == key)
+                {
+                    value = Transposition::VALUE(data);
+
+                    depth = Transposition::DEPTH(data);
+
+                    Hits.fetch_add(1, std::memory_order_relaxed);
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        bool PROBE(std::uint64_t key)
+        {
+            auto value = 0;
+
+            auto depth = 0;
+
+            return PROBE(key, value, depth);
+        }
+
+        void STORE(std::uint64_t key, int value, int depth)
+        {
+            auto generation = Generation.load(std::memory_order_relaxed);
+
+            auto data = Transposition::PACK(value, depth, generation);
+
+            auto bucket = &Entries[(key & Mask) * 2];
+
+            auto stored = bucket[0].Data.load(std::memory_order_relaxed);
+
+            auto same = stored != 0 && (bucket[0].Check.load(std::memory_order_relaxed) ^ stored) == key;
+
+            auto slot = (stored == 0 || same || depth >= Transposition::DEPTH(stored) || Transposition::GENERATION(stored) != (std::uint16_t)generation) ? 0 : 1;
+
+            if (slot == 1)
+            {
+                stored = bucket[1].Data.load(std::memory_order_relaxed);
+
+                same = stored != 0 && (bucket[1].Check.load(std::memory_order_relaxed) ^ stored) == key;
+            }
+
+            if (stored != 0 && !same)
+            {
+                Replacements.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            bucket[slot].Check.store(key ^ data, std::memory_order_relaxed);
+
+            bucket[slot].Data.store(data, std::memory_order_relaxed);
+
+            Stores.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // entries from earlier generations give way to new ones regardless of depth
+        void AGE()
+        {
+            auto generation = Generation.load() % 0xFFFF + 1;
+
+            Generation.store(generation);
+        }
+
+        double HIT_RATE()
+        {
+            return Probes > 0 ? (double)Hits / Probes : 0.0;
+        }
+    };
+
+} // namespace Transposition
+
+#endif
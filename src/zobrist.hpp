@@ -0,0 +1,103 @@
+#ifndef __ZOBRIST__HPP__
+#define __ZOBRIST__HPP__
+
+#include <cstdint>
+
+// Incremental state hashing: every part of a character contributes a pseudo-random key and the hash is the sum of those keys,
+// so a mutation only adds the keys of what it gains and subtracts the keys of what it loses
+namespace Zobrist
+{
+    enum class Field : std::uint64_t
+    {
+        NONE = 0,
+        LIFE,
+        MONEY,
+        ITEM_LIMIT,
+        LIFE_LIMIT,
+        SKILLS_LIMIT,
+        SHIP,
+        STARS,
+        SKILL,
+        TEMPORARY_SKILL,
+        ITEM,
+        CODEWORD,
+        SECTION
+    };
+
+    // splitmix64 finalizer, stands in for a table of random numbers
+    constexpr std::uint64_t MIX(std::uint64_t x)
+    {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+
+        return x ^ (x >> 31);
+    }
+
+    constexpr std::uint64_t KEY(Zobrist::Field field, std::uint64_t value)
+    {
+        return Zobrist::MIX(((std::uint64_t)field << 56) ^ Zobrist::MIX(value));
+    }
+
+    constexpr std::uint64_t KEY(Zobrist::Field field, int value)
+    {
+        return Zobrist::KEY(field, (std::uint64_t)(std::uint32_t)value);
+    }
+
+    static_assert(Zobrist::KEY(Zobrist::Field::LIFE, 1) != Zobrist::KEY(Zobrist::Field::MONEY, 1), "fields need distinct keys");
+
+    // key of a whole item, charge and variant included
+    template <typename T>
+    constexpr std::uint64_t ITEM(const T &item)
+    {
+        return Zobrist::KEY(Zobrist::Field::ITEM, ((std::uint64_t)item.Type << 32) | ((std::uint64_t)item.Variant << 16) | (std::uint16_t)item.Charge);
+    }
+
+    template <typename T>
+    std::uint64_t SUM(Zobrist::Field field, const T &list)
+    {
+        std::uint64_t sum = 0;
+
+        for (auto i = 0; i < list.size(); i++)
+        {
+            sum += Zobrist::KEY(field, (int)list[i].Type);
+        }
+
+        return sum;
+    }
+
+    // hash of a complete character, used to seed the incremental hash
+    template <typename T>
+    std::uint64_t STATE(const T &player)
+    {
+        auto hash = Zobrist::KEY(Zobrist::Field::LIFE, player.Life);
+
+        hash += Zobrist::KEY(Zobrist::Field::MONEY, player.Money);
+        hash += Zobrist::KEY(Zobrist::Field::ITEM_LIMIT, player.ITEM_LIMIT);
+        hash += Zobrist::KEY(Zobrist::Field::LIFE_LIMIT, player.MAX_LIFE_LIMIT);
+        hash += Zobrist::KEY(Zobrist::Field::SKILLS_LIMIT, player.SKILLS_LIMIT);
+        hash += Zobrist::KEY(Zobrist::Field::SHIP, (int)player.Ship.Type);
+        hash += Zobrist::KEY(Zobrist::Field::STARS, player.Ship.Stars);
+        hash += Zobrist::SUM(Zobrist::Field::SKILL, player.Skills);
+        hash += Zobrist::SUM(Zobrist::Field::TEMPORARY_SKILL, player.TemporarySkills);
+
+        for (auto i = 0; i < player.Items.size(); i++)
+        {
+            hash += Zobrist::ITEM(player.Items[i]);
+        }
+
+        for (auto i = 0; i < player.Codewords.size(); i++)
+        {
+            hash += Zobrist::KEY(Zobrist::Field::CODEWORD, (int)player.Codewords[i]);
+        }
+
+        return hash;
+    }
+
+    constexpr std::uint64_t SECTION(int id)
+    {
+        return Zobrist::KEY(Zobrist::Field::SECTION, id);
+    }
+} // namespace Zobrist
+
+#endif